@@ -0,0 +1,66 @@
+// Benchmark for generating nested line loops (AddNestedLoops in LineBatch.h). Not part of the main project, build it on its own:
+//   MSVC:     cl /O2 /EHsc /I..\src /I..\inc LineBench.cpp ..\src\LineBatch.cpp ..\src\glad.c
+//   GCC/Clang: g++ -O2 -I../src -I../inc LineBench.cpp ../src/LineBatch.cpp ../src/glad.c -o LineBench
+//
+// Only the CPU side is timed, no GL context is created. Drawing costs one upload and one glMultiDrawArrays
+// however many layers there are.
+// Squares shrink by half their area every layer, so they hit EPSILON after ~40 layers. Polygons with more
+// sides shrink much slower, which is what the thousands-of-layers cases use.
+#include "LineBatch.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+constexpr int REPETITIONS = 9;
+
+struct Case
+{
+	int sides;
+	int layers;
+};
+
+// Regular polygon with its corners on the unit circle
+static std::vector<Vector2> Polygon(int sides)
+{
+	std::vector<Vector2> points(sides);
+	for (int i = 0; i < sides; i++)
+		points[i] = Direction(2.0f * PI * i / sides);
+	return points;
+}
+
+int main()
+{
+	const Case cases[] =
+	{
+		{ 4, 8 },	// Assignment 2's squares
+		{ 4, 1000 },
+		{ 256, 1000 },
+		{ 256, 10000 },
+		{ 1024, 10000 }
+	};
+
+	printf("%-8s %-8s %-10s %-12s %-12s %s\n", "Sides", "Layers", "Loops", "Points", "Time (ms)", "Mpoints/s");
+	LineBatch batch;
+	for (const Case& c : cases)
+	{
+		std::vector<Vector2> polygon = Polygon(c.sides);
+
+		// Median of the repetitions. The batch is reused like it would be every frame, so only the first run allocates.
+		double times[REPETITIONS];
+		for (double& time : times)
+		{
+			ClearLineBatch(&batch);
+			std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+			AddNestedLoops(&batch, polygon.data(), c.sides, c.layers);
+			time = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		}
+		std::nth_element(times, times + REPETITIONS / 2, times + REPETITIONS);
+		double median = times[REPETITIONS / 2];
+
+		int points = (int)batch.points.size();
+		printf("%-8i %-8i %-10i %-12i %-12.3f %.1f\n",
+			c.sides, c.layers, (int)batch.counts.size(), points, median, points / (median * 1000.0));
+	}
+	return 0;
+}
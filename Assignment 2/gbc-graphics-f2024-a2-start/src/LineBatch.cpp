@@ -0,0 +1,102 @@
+#include "LineBatch.h"
+
+void CreateLineBatch(LineBatch* batch)
+{
+	glGenVertexArrays(1, &batch->vao);
+	glBindVertexArray(batch->vao);
+
+	// Storage is allocated on the first upload, once we know how many points there are
+	glGenBuffers(1, &batch->vbo);
+	glBindBuffer(GL_ARRAY_BUFFER, batch->vbo);
+	glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vector2), nullptr);
+	glEnableVertexAttribArray(0);
+
+	glBindVertexArray(GL_NONE);
+	glBindBuffer(GL_ARRAY_BUFFER, GL_NONE);
+}
+
+void DestroyLineBatch(LineBatch* batch)
+{
+	glDeleteBuffers(1, &batch->vbo);
+	glDeleteVertexArrays(1, &batch->vao);
+	batch->vao = batch->vbo = GL_NONE;
+	batch->capacity = 0;
+}
+
+void ClearLineBatch(LineBatch* batch)
+{
+	batch->points.clear();
+	batch->firsts.clear();
+	batch->counts.clear();
+	batch->dirty = true;
+}
+
+void AddLineLoop(LineBatch* batch, const Vector2* points, int count)
+{
+	batch->firsts.push_back((GLint)batch->points.size());
+	batch->counts.push_back(count);
+	batch->points.insert(batch->points.end(), points, points + count);
+	batch->dirty = true;
+}
+
+void AddNestedLoops(LineBatch* batch, const Vector2* points, int count, int layers)
+{
+	if (count < 2 || layers < 1)
+		return;
+
+	// Reserve every layer up front, each one is written directly after the previous one
+	size_t start = batch->points.size();
+	batch->points.resize(start + (size_t)count * layers);
+	batch->firsts.reserve(batch->firsts.size() + layers);
+	batch->counts.reserve(batch->counts.size() + layers);
+
+	Vector2* curr = batch->points.data() + start;
+	for (int i = 0; i < count; i++)
+		curr[i] = points[i];
+
+	int layer = 0;
+	while (true)
+	{
+		batch->firsts.push_back((GLint)(start + (size_t)layer * count));
+		batch->counts.push_back(count);
+		if (++layer == layers || LengthSqr(curr[1] - curr[0]) < EPSILON * EPSILON)
+			break;
+
+		Vector2* next = curr + count;
+		for (int i = 0; i < count - 1; i++)
+			next[i] = (curr[i] + curr[i + 1]) * 0.5f;
+		next[count - 1] = (curr[count - 1] + curr[0]) * 0.5f;
+		curr = next;
+	}
+
+	// Drop the layers we didn't need
+	batch->points.resize(start + (size_t)layer * count);
+	batch->dirty = true;
+}
+
+void DrawLineBatch(LineBatch* batch)
+{
+	if (batch->counts.empty())
+		return;
+
+	glBindVertexArray(batch->vao);
+	if (batch->dirty)
+	{
+		// Grow by reallocating (which also orphans the old storage), otherwise overwrite in place
+		int count = (int)batch->points.size();
+		glBindBuffer(GL_ARRAY_BUFFER, batch->vbo);
+		if (count > batch->capacity)
+		{
+			glBufferData(GL_ARRAY_BUFFER, count * sizeof(Vector2), batch->points.data(), GL_DYNAMIC_DRAW);
+			batch->capacity = count;
+		}
+		else
+		{
+			glBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(Vector2), batch->points.data());
+		}
+		glBindBuffer(GL_ARRAY_BUFFER, GL_NONE);
+		batch->dirty = false;
+	}
+
+	glMultiDrawArrays(GL_LINE_LOOP, batch->firsts.data(), batch->counts.data(), (GLsizei)batch->counts.size());
+}
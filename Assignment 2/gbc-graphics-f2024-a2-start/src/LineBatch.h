@@ -0,0 +1,36 @@
+#pragma once
+#include <glad/glad.h>
+#include <vector>
+#include "Math.h"
+
+// Any number of line loops stored back to back in one vertex buffer and drawn with a single glMultiDrawArrays.
+// Vertices are 2D, attribute location 0 (see lines.vert).
+struct LineBatch
+{
+	// CPU data
+	std::vector<Vector2> points;	// Every loop's points, back to back
+	std::vector<GLint> firsts;		// Index of each loop's first point
+	std::vector<GLsizei> counts;	// Number of points in each loop
+
+	// GPU data
+	GLuint vao = GL_NONE;
+	GLuint vbo = GL_NONE;
+	int capacity = 0;	// Points the vbo can hold
+	bool dirty = false;	// Points changed since the last upload
+};
+
+void CreateLineBatch(LineBatch* batch);
+void DestroyLineBatch(LineBatch* batch);
+
+// Removes every loop. Keeps the memory, so refilling a batch every frame doesn't allocate.
+void ClearLineBatch(LineBatch* batch);
+
+void AddLineLoop(LineBatch* batch, const Vector2* points, int count);
+
+// Adds the loop, then layers - 1 more loops, each through the midpoints of the previous loop's edges.
+// Stops early once a loop shrinks below EPSILON, since every layer after that draws as the same point.
+// Doesn't touch OpenGL, so it can be used (and timed) without a context.
+void AddNestedLoops(LineBatch* batch, const Vector2* points, int count, int layers);
+
+// Uploads the points if they changed, then draws every loop with one call
+void DrawLineBatch(LineBatch* batch);
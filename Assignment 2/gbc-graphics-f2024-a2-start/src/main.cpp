@@ -1,5 +1,6 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "LineBatch.h"
 #include "Math.h"
 
 #include <cassert>
@@ -25,41 +26,6 @@ bool IsKeyPressed(int key);
 
 void Print(Matrix m);
 
-void DrawLineLoopAuto(Vector2* points, int pointCount, int createAmount)
-{
-    float thickness = 7.0f;
-    Vector2 currentLayer[4];
-    Vector2* tempPointsArray = new Vector2[pointCount * createAmount];
-    for (int i = 0; i < pointCount; i++)
-    {
-        currentLayer[i] = points[i];
-    }
-
-    for (int k = 0; k < createAmount; k++)
-    {
-        Vector2 nextLayer[4];
-
-        for (int curr = 0; curr < pointCount; curr++)
-        {
-            int next = (curr + 1) % pointCount;
-            Vector2 A = currentLayer[curr];
-            Vector2 B = currentLayer[next];
-
-            tempPointsArray[k * 4 + curr] = currentLayer[curr];
-            std::cout << "x: " << tempPointsArray[k * 4 + curr].x << "y: " << tempPointsArray[k * 4 + curr].y << "positionD: " << k*4+curr << std::endl;
-            glBufferSubData(GL_ARRAY_BUFFER, 0, 4 * sizeof(Vector2), currentLayer);
-            glDrawArrays(GL_LINE_LOOP, 0, 4);
-             nextLayer[curr] = (currentLayer[curr] + currentLayer[next]) * 0.5f;
-        }
-        for (int i = 0; i < pointCount; i++)
-        {
-            currentLayer[i] = nextLayer[i];
-        }
-    }
-    //glBufferSubData(GL_ARRAY_BUFFER, 0, 4 * sizeof(Vector2), tempPointsArray);
-    //glDrawArrays(GL_LINE_LOOP, 0, 4); // Thinking this only draws lines from vertex 0, 1, 2, 3 ,4. Cannot find the rest of the vertex to draw from
-}
-
 int main(void)
 {
     // Lines 20-40 are all window creation. You can ignore this if you want ;)
@@ -124,14 +90,6 @@ int main(void)
         { -1.0f, -1.0f }    // bot-left
     };
 
-    Vector2 next[4]
-    {
-        (curr[0] + curr[1]) * 0.5f,
-        (curr[1] + curr[2]) * 0.5f,
-        (curr[2] + curr[3]) * 0.5f,
-        (curr[3] + curr[0]) * 0.5f
-    };
-
     // vao = "Vertex Array Object". A vao is a collection of vbos.
     // vbo = "Vertex Buffer Object". "Buffer" generally means "group of memory".
     // A vbo is a piece of graphics memory VRAM.
@@ -153,15 +111,10 @@ int main(void)
     glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vector3), 0);          // Describe the buffer
     glEnableVertexAttribArray(1);
 
-    GLuint vaoLines, pboLines, cboLines;
-    glGenVertexArrays(1, &vaoLines);
-    glBindVertexArray(vaoLines);
-
-    glGenBuffers(1, &pboLines);
-    glBindBuffer(GL_ARRAY_BUFFER, pboLines);
-    glBufferData(GL_ARRAY_BUFFER, 4 * sizeof(Vector2), curr, GL_STATIC_DRAW);
-    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vector2), nullptr);
-    glEnableVertexAttribArray(0);
+    // The nested squares never change, so they're generated and uploaded once then drawn with a single call
+    LineBatch lineBatch;
+    CreateLineBatch(&lineBatch);
+    AddNestedLoops(&lineBatch, curr, 4, 8);
 
     // In summary, we need 3 things to render:
     // 1. Vertex data -- right now just positions.
@@ -249,17 +202,11 @@ int main(void)
             break;
 
         case 3:
-            // TODO -- read up on glBufferSubData to understand what on earth just happened ;)
             shaderProgram = shaderLines;
             glUseProgram(shaderProgram);
             glUniform1f(glGetUniformLocation(shaderProgram, "u_a"), a);
             glLineWidth(5.0f);
-            glBindVertexArray(vaoLines);
-            DrawLineLoopAuto(curr, 4, 8);
-            //glBufferSubData(GL_ARRAY_BUFFER, 0, 4 * sizeof(Vector2), curr);
-            //glDrawArrays(GL_LINE_LOOP, 0, 4);
-            //glBufferSubData(GL_ARRAY_BUFFER, 0, 4 * sizeof(Vector2), next);
-            //glDrawArrays(GL_LINE_LOOP, 0, 4);
+            DrawLineBatch(&lineBatch);
             break;
 
         case 4:
@@ -300,6 +247,7 @@ int main(void)
         glfwPollEvents();
     }
 
+    DestroyLineBatch(&lineBatch);
     glfwTerminate();
     return 0;
 }
@@ -4,7 +4,6 @@ layout (location = 0) in vec3 aPosition;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTcoord;
 
-uniform mat4 u_mvp;
 uniform mat4 u_world;
 uniform mat3 u_normal;
 
@@ -15,7 +14,7 @@ out vec2 tcoord;
 void main()
 {
    position = (u_world * vec4(aPosition, 1.0)).xyz;
-   gl_Position = u_mvp * vec4(aPosition, 1.0);
+   gl_Position = u_viewProj * vec4(position, 1.0);
    normal = u_normal * aNormal;
    tcoord = aTcoord;
 }
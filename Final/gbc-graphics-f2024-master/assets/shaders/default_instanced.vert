@@ -0,0 +1,34 @@
+#version 460 core
+
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTcoord;
+
+// Must match InstanceData in Shader.h
+struct Instance
+{
+    mat4 world;
+    mat3 normal;
+    vec4 color;
+};
+
+layout (std430, binding = 0) readonly buffer Instances
+{
+    Instance u_instances[];
+};
+
+out vec3 position;
+out vec3 normal;
+out vec2 tcoord;
+out vec4 color;
+
+void main()
+{
+   // Draws share one buffer, gl_BaseInstance is where this draw's instances start
+   Instance instance = u_instances[gl_BaseInstance + gl_InstanceID];
+   position = (instance.world * vec4(aPosition, 1.0)).xyz;
+   gl_Position = u_viewProj * vec4(position, 1.0);
+   normal = instance.normal * aNormal;
+   tcoord = aTcoord;
+   color = instance.color;
+}
@@ -0,0 +1,36 @@
+#version 460 core
+
+layout (location = 0) in vec3 aPosition;
+layout (location = 1) in vec3 aNormal;
+layout (location = 2) in vec2 aTcoord;
+
+// Must match InstanceData in Shader.h, one per command of a multi-draw
+struct Instance
+{
+    mat4 world;
+    mat3 normal;
+    vec4 color;
+};
+
+layout (std430, binding = 1) readonly buffer Draws
+{
+    Instance u_draws[];
+};
+
+// Where this multi-draw's data starts, gl_DrawID restarts at 0 for every multi-draw
+uniform int u_firstDraw;
+
+out vec3 position;
+out vec3 normal;
+out vec2 tcoord;
+out vec4 color;
+
+void main()
+{
+   Instance draw = u_draws[u_firstDraw + gl_DrawID];
+   position = (draw.world * vec4(aPosition, 1.0)).xyz;
+   gl_Position = u_viewProj * vec4(position, 1.0);
+   normal = draw.normal * aNormal;
+   tcoord = aTcoord;
+   color = draw.color;
+}
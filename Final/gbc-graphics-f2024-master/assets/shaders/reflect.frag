@@ -4,13 +4,12 @@ in vec3 position;
 in vec3 normal;
 
 uniform samplerCube u_cubemap;
-uniform vec3 u_cameraPosition;
 
 out vec4 FragColor;
 
 void main()
 {
-    vec3 I = normalize(position - u_cameraPosition);
+    vec3 I = normalize(position - u_cameraPosition.xyz);
     vec3 R = reflect(I, normalize(normal));
 
     vec3 col = texture(u_cubemap, R).xyz;
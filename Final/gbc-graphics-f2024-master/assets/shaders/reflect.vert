@@ -3,7 +3,6 @@
 layout (location = 0) in vec3 aPosition;
 layout (location = 1) in vec3 aNormal;
 
-uniform mat4 u_mvp;
 uniform mat4 u_world;
 uniform mat3 u_normal;
 
@@ -12,7 +11,7 @@ out vec3 normal;
 
 void main()
 {
-   normal = mat3(transpose(inverse(u_world))) * aNormal;
+   normal = u_normal * aNormal;
    position = vec3(u_world * vec4(aPosition, 1.0));
-   gl_Position = u_mvp * vec4(aPosition, 1.0);
+   gl_Position = u_viewProj * vec4(position, 1.0);
 }
@@ -2,13 +2,12 @@
 
 layout (location = 0) in vec3 aPosition;
 
-uniform mat4 u_mvp;
-
 out vec3 position;
 
 void main()
 {
 	position = aPosition;
 
-	gl_Position = u_mvp * vec4(aPosition, 1.0);
+	// Remove the view's translation so the skybox is always centred on the camera
+	gl_Position = u_proj * mat4(mat3(u_view)) * vec4(aPosition, 1.0);
 }
@@ -9,35 +9,26 @@ uniform float u_tex_scrolling;
 
 out vec4 FragColor;
 
-uniform vec3 u_cameraPositionPoint;
-uniform vec3 u_lightPositionPoint;
-uniform vec3 u_lightColorPoint;
-uniform float u_lightRadiusPoint;
-
-uniform vec3 u_lightPositionSpot;
-uniform vec3 u_lightColorSpot;
-uniform vec3 u_lightDirSpot;
-uniform float u_lightRadiusSpot;
-
 void main()
 {
- 
+    Light point = u_lights[0];
+    Light spot = u_lights[1];
 
     // Point Light
     vec3 N = normalize(normal);
-    vec3 L = normalize(u_lightPositionPoint - position);
-    vec3 V = normalize(u_cameraPositionPoint - position);
+    vec3 L = normalize(point.position.xyz - position);
+    vec3 V = normalize(u_cameraPosition.xyz - position);
     vec3 R = normalize(reflect(L, N));
     float dotNL = max(dot(N, L), 0.0);
     float dotVR = max(dot(V, R), 0.0);
 
-    float dist = length(u_lightPositionPoint - position);
-    float attenuation = clamp(u_lightRadiusPoint / dist, 0.0, 1.0);
+    float dist = length(point.position.xyz - position);
+    float attenuation = clamp(point.radius / dist, 0.0, 1.0);
 
     vec3 lighting = vec3(0.0);
-    vec3 ambient = u_lightColorPoint * 0.3;
-    vec3 diffuse = u_lightColorPoint * dotNL;
-    vec3 specular = u_lightColorPoint * pow(dotVR, 4);
+    vec3 ambient = point.color.rgb * 0.3;
+    vec3 diffuse = point.color.rgb * dotNL;
+    vec3 specular = point.color.rgb * pow(dotVR, 4);
 
     lighting += ambient;
     lighting += diffuse;
@@ -45,18 +36,18 @@ void main()
     lighting *= attenuation;
 
     // Spot Light
-    vec3 LSpot = normalize(u_lightPositionSpot - position);
-    vec3 spotDir = normalize(-u_lightDirSpot);
+    vec3 LSpot = normalize(spot.position.xyz - position);
+    vec3 spotDir = normalize(-spot.direction.xyz);
     float theta = dot(LSpot, spotDir);
 
-    float inCutoff = cos(radians(u_lightRadiusSpot / 2.0));
-    float outCutoff = cos(radians((u_lightRadiusSpot / 2.0) + 0.5));
+    float inCutoff = cos(radians(spot.radius / 2.0));
+    float outCutoff = cos(radians((spot.radius / 2.0) + 0.5));
     float epsilon = inCutoff - outCutoff;
 
     float intensity = clamp((theta - outCutoff) / epsilon, 0.0, 1.0);
 
     vec3 lightingSpot = vec3(0.0);
-    vec3 ambientSpot = u_lightColorSpot * 0.3;
+    vec3 ambientSpot = spot.color.rgb * 0.3;
 
     lightingSpot += ambientSpot;
     lightingSpot *= intensity;
@@ -0,0 +1,349 @@
+// Microbenchmark for the SIMD matrix functions in Math.h and the batch functions in MathBatch.h. Not part of the main project, build it on its own:
+//   MSVC:     cl /O2 /EHsc /I..\src MathBench.cpp
+//   GCC/Clang: g++ -O2 -I../src MathBench.cpp -o MathBench
+// Add -DMATH_NO_SIMD (/DMATH_NO_SIMD) to benchmark the scalar versions against themselves.
+//
+// Checks the SIMD results against the *Scalar versions (see the tolerance notes at the top of Math.h)
+// and the batch results against the single-object versions, then times each pair over the same inputs.
+// NOTE: GCC and Clang auto-vectorize MultiplyScalar at -O2 into nearly the same code as the SSE path, so expect
+// no difference there. Add -fno-tree-vectorize to see what a compiler that doesn't (ie MSVC) gets.
+#include "Math.h"
+#include "MathBatch.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+constexpr int MATRIX_COUNT = 1024;
+constexpr int ITERATIONS = 2000;
+
+// Keeps the optimizer from throwing away results
+static volatile float gSink;
+
+// World matrix like the ones the renderer builds every frame
+static Matrix RandomWorld()
+{
+	Vector3 scale = { Random(0.1f, 10.0f), Random(0.1f, 10.0f), Random(0.1f, 10.0f) };
+	Vector3 angles = { Random(-PI, PI), Random(-PI, PI), Random(-PI, PI) };
+	Vector3 translation = { Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f) };
+	return Scale(scale) * RotateXYZ(angles) * Translate(translation);
+}
+
+// Dense matrix with no structure, biased towards the diagonal to stay well-conditioned
+static Matrix RandomDense()
+{
+	Matrix m;
+	float* f = &m.m0;
+	for (int i = 0; i < 16; i++)
+		f[i] = Random(-1.0f, 1.0f) + (i % 5 == 0 ? 4.0f : 0.0f);
+	return m;
+}
+
+static float Ulp(float x)
+{
+	x = fabsf(x);
+	return nextafterf(x, INFINITY) - x;
+}
+
+// Largest difference between a and b in ULPs of the largest element in the same memory row.
+// Per-element ULPs are meaningless for elements that should be 0 but come out as 1e-9.
+static float MaxRowUlps(const Matrix& a, const double* b)
+{
+	const float* fa = &a.m0;
+	float result = 0.0f;
+	for (int row = 0; row < 4; row++)
+	{
+		double scale = 0.0;
+		for (int col = 0; col < 4; col++)
+			scale = fmax(scale, fabs(b[row * 4 + col]));
+		for (int col = 0; col < 4; col++)
+			result = fmaxf(result, (float)(fabs(fa[row * 4 + col] - b[row * 4 + col]) / Ulp((float)scale)));
+	}
+	return result;
+}
+
+static float MaxRowUlps(const Matrix& a, const Matrix& b)
+{
+	double reference[16];
+	for (int i = 0; i < 16; i++)
+		reference[i] = (&b.m0)[i];
+	return MaxRowUlps(a, reference);
+}
+
+// Double-precision Gauss-Jordan inverse with partial pivoting, the reference both versions are measured against
+static void InvertReference(const Matrix& mat, double* result)
+{
+	double a[4][8];
+	for (int row = 0; row < 4; row++)
+	{
+		for (int col = 0; col < 4; col++)
+		{
+			a[row][col] = (&mat.m0)[row * 4 + col];
+			a[row][col + 4] = row == col ? 1.0 : 0.0;
+		}
+	}
+
+	for (int col = 0; col < 4; col++)
+	{
+		int pivot = col;
+		for (int row = col + 1; row < 4; row++)
+		{
+			if (fabs(a[row][col]) > fabs(a[pivot][col]))
+				pivot = row;
+		}
+		for (int k = 0; k < 8; k++)
+			std::swap(a[col][k], a[pivot][k]);
+
+		double d = a[col][col];
+		for (int k = 0; k < 8; k++)
+			a[col][k] /= d;
+
+		for (int row = 0; row < 4; row++)
+		{
+			if (row == col)
+				continue;
+			double f = a[row][col];
+			for (int k = 0; k < 8; k++)
+				a[row][k] -= f * a[col][k];
+		}
+	}
+
+	for (int row = 0; row < 4; row++)
+	{
+		for (int col = 0; col < 4; col++)
+			result[row * 4 + col] = a[row][col + 4];
+	}
+}
+
+template<typename F>
+static double Time(F f)
+{
+	auto start = std::chrono::high_resolution_clock::now();
+	for (int i = 0; i < ITERATIONS; i++)
+		f();
+	auto end = std::chrono::high_resolution_clock::now();
+	return std::chrono::duration<double, std::nano>(end - start).count() / (ITERATIONS * (double)MATRIX_COUNT);
+}
+
+static void Report(const char* name, double scalar, double simd)
+{
+	printf("%-18s scalar %6.2f ns  simd %6.2f ns  speedup %.2fx\n", name, scalar, simd, scalar / simd);
+}
+
+int main()
+{
+#if defined(MATH_SSE)
+	printf("Path: SSE\n");
+#elif defined(MATH_NEON)
+	printf("Path: NEON\n");
+#else
+	printf("Path: scalar (no SIMD)\n");
+#endif
+
+	srand(1);
+	std::vector<Matrix> a(MATRIX_COUNT), b(MATRIX_COUNT), dense(MATRIX_COUNT), out(MATRIX_COUNT);
+	std::vector<Vector4> v(MATRIX_COUNT), vout(MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++)
+	{
+		a[i] = RandomWorld();
+		b[i] = RandomWorld();
+		dense[i] = RandomDense();
+		v[i] = { Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), Random(-100.0f, 100.0f), 1.0f };
+	}
+
+	// Accuracy
+	int multiplyMismatches = 0;
+	int transformMismatches = 0;
+	float invertWorldUlps = 0.0f;
+	float invertDenseUlps = 0.0f;
+	float worldScalarError = 0.0f, worldSimdError = 0.0f;
+	float denseScalarError = 0.0f, denseSimdError = 0.0f;
+	for (int i = 0; i < MATRIX_COUNT; i++)
+	{
+		Matrix m0 = Multiply(a[i], b[i]);
+		Matrix m1 = MultiplyScalar(a[i], b[i]);
+		multiplyMismatches += memcmp(&m0, &m1, sizeof(Matrix)) != 0;
+
+		Vector4 v0 = a[i] * v[i];
+		Quaternion v1 = MultiplyScalar(Quaternion{ v[i].x, v[i].y, v[i].z, v[i].w }, a[i]);
+		transformMismatches += memcmp(&v0, &v1, sizeof(Vector4)) != 0;
+
+		invertWorldUlps = fmaxf(invertWorldUlps, MaxRowUlps(Invert(a[i]), InvertScalar(a[i])));
+		invertDenseUlps = fmaxf(invertDenseUlps, MaxRowUlps(Invert(dense[i]), InvertScalar(dense[i])));
+
+		double reference[16];
+		InvertReference(a[i], reference);
+		worldScalarError = fmaxf(worldScalarError, MaxRowUlps(InvertScalar(a[i]), reference));
+		worldSimdError = fmaxf(worldSimdError, MaxRowUlps(Invert(a[i]), reference));
+		InvertReference(dense[i], reference);
+		denseScalarError = fmaxf(denseScalarError, MaxRowUlps(InvertScalar(dense[i]), reference));
+		denseSimdError = fmaxf(denseSimdError, MaxRowUlps(Invert(dense[i]), reference));
+	}
+	printf("Multiply:        %d/%d results differ from scalar\n", multiplyMismatches, MATRIX_COUNT);
+	printf("Matrix*Vector4:  %d/%d results differ from scalar\n", transformMismatches, MATRIX_COUNT);
+	printf("Invert (world):  max %.2f ULP from scalar (exact: scalar %.2f, simd %.2f)\n", invertWorldUlps, worldScalarError, worldSimdError);
+	printf("Invert (dense):  max %.2f ULP from scalar (exact: scalar %.2f, simd %.2f)\n", invertDenseUlps, denseScalarError, denseSimdError);
+
+	// Speed
+	double multiplyScalar = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			out[i] = MultiplyScalar(a[i], b[i]);
+		gSink = out[MATRIX_COUNT / 2].m0;
+	});
+	double multiplySimd = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			out[i] = Multiply(a[i], b[i]);
+		gSink = out[MATRIX_COUNT / 2].m0;
+	});
+
+	double invertScalar = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			out[i] = InvertScalar(a[i]);
+		gSink = out[MATRIX_COUNT / 2].m0;
+	});
+	double invertSimd = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			out[i] = Invert(a[i]);
+		gSink = out[MATRIX_COUNT / 2].m0;
+	});
+
+	double transformScalar = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+		{
+			Quaternion q = MultiplyScalar(Quaternion{ v[i].x, v[i].y, v[i].z, v[i].w }, a[i]);
+			vout[i] = { q.x, q.y, q.z, q.w };
+		}
+		gSink = vout[MATRIX_COUNT / 2].x;
+	});
+	double transformSimd = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			vout[i] = a[i] * v[i];
+		gSink = vout[MATRIX_COUNT / 2].x;
+	});
+
+	Report("Multiply", multiplyScalar, multiplySimd);
+	Report("Invert", invertScalar, invertSimd);
+	Report("Matrix*Vector4", transformScalar, transformSimd);
+
+	// Batch versions against calling the single-object versions in a loop
+	std::vector<float> px(MATRIX_COUNT), py(MATRIX_COUNT), pz(MATRIX_COUNT);
+	std::vector<float> sx(MATRIX_COUNT), sy(MATRIX_COUNT), sz(MATRIX_COUNT);
+	std::vector<float> qx(MATRIX_COUNT), qy(MATRIX_COUNT), qz(MATRIX_COUNT), qw(MATRIX_COUNT);
+	std::vector<float> tx(MATRIX_COUNT), ty(MATRIX_COUNT), tz(MATRIX_COUNT), tw(MATRIX_COUNT);
+	std::vector<float> ox(MATRIX_COUNT), oy(MATRIX_COUNT), oz(MATRIX_COUNT), ow(MATRIX_COUNT);
+	std::vector<float> rx(MATRIX_COUNT), ry(MATRIX_COUNT), rz(MATRIX_COUNT);
+	std::vector<float> amounts(MATRIX_COUNT);
+	std::vector<Vector3> points(MATRIX_COUNT), scales(MATRIX_COUNT), results(MATRIX_COUNT);
+	std::vector<Quaternion> rotations(MATRIX_COUNT), targets(MATRIX_COUNT), slerps(MATRIX_COUNT);
+	std::vector<Matrix> composed(MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++)
+	{
+		points[i] = { v[i].x, v[i].y, v[i].z };
+		scales[i] = { Random(0.1f, 10.0f), Random(0.1f, 10.0f), Random(0.1f, 10.0f) };
+		Vector3 angles = { Random(-PI, PI), Random(-PI, PI), Random(-PI, PI) };
+		rotations[i] = FromEuler(angles.x, angles.y, angles.z);
+
+		// Every Slerp case: far apart, close enough to Nlerp, and identical
+		if (i % 4 == 0)
+			targets[i] = rotations[i];
+		else if (i % 4 == 1)
+			targets[i] = FromEuler(angles.x + 0.1f, angles.y, angles.z);
+		else
+			targets[i] = FromEuler(Random(-PI, PI), Random(-PI, PI), Random(-PI, PI));
+		amounts[i] = Random(0.0f, 1.0f);
+
+		px[i] = points[i].x; py[i] = points[i].y; pz[i] = points[i].z;
+		sx[i] = scales[i].x; sy[i] = scales[i].y; sz[i] = scales[i].z;
+		qx[i] = rotations[i].x; qy[i] = rotations[i].y; qz[i] = rotations[i].z; qw[i] = rotations[i].w;
+		tx[i] = targets[i].x; ty[i] = targets[i].y; tz[i] = targets[i].z; tw[i] = targets[i].w;
+	}
+	Vector3SoA pointsSoA = { px.data(), py.data(), pz.data() };
+	Vector3SoA scalesSoA = { sx.data(), sy.data(), sz.data() };
+	Vector3SoA resultsSoA = { rx.data(), ry.data(), rz.data() };
+	QuaternionSoA rotationsSoA = { qx.data(), qy.data(), qz.data(), qw.data() };
+	QuaternionSoA targetsSoA = { tx.data(), ty.data(), tz.data(), tw.data() };
+	QuaternionSoA slerpsSoA = { ox.data(), oy.data(), oz.data(), ow.data() };
+
+	// MathBatch.h promises the same results as the single-object versions, bit for bit
+	int composeMismatches = 0;
+	int pointsMismatches = 0;
+	int slerpMismatches = 0;
+	int normalizeMismatches = 0;
+	Compose(pointsSoA, rotationsSoA, scalesSoA, composed.data(), MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++)
+	{
+		Matrix m = Scale(scales[i]) * ToMatrix(rotations[i]) * Translate(points[i]);
+		composeMismatches += memcmp(&m, &composed[i], sizeof(Matrix)) != 0;
+	}
+	Transform(a[0], pointsSoA, resultsSoA, MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++)
+	{
+		Vector3 p = a[0] * points[i];
+		pointsMismatches += p.x != rx[i] || p.y != ry[i] || p.z != rz[i];
+	}
+	Slerp(rotationsSoA, targetsSoA, amounts.data(), slerpsSoA, MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++)
+	{
+		Quaternion q = Slerp(rotations[i], targets[i], amounts[i]);
+		slerpMismatches += q.x != ox[i] || q.y != oy[i] || q.z != oz[i] || q.w != ow[i];
+	}
+	Normalize(pointsSoA, resultsSoA, MATRIX_COUNT);
+	for (int i = 0; i < MATRIX_COUNT; i++)
+	{
+		Vector3 n = Normalize(points[i]);
+		normalizeMismatches += n.x != rx[i] || n.y != ry[i] || n.z != rz[i];
+	}
+	printf("\nBatch Compose:   %d/%d results differ from single\n", composeMismatches, MATRIX_COUNT);
+	printf("Batch Transform: %d/%d results differ from single\n", pointsMismatches, MATRIX_COUNT);
+	printf("Batch Slerp:     %d/%d results differ from single\n", slerpMismatches, MATRIX_COUNT);
+	printf("Batch Normalize: %d/%d results differ from single\n", normalizeMismatches, MATRIX_COUNT);
+
+	double composeSingle = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			out[i] = Scale(scales[i]) * ToMatrix(rotations[i]) * Translate(points[i]);
+		gSink = out[MATRIX_COUNT / 2].m0;
+	});
+	double composeBatch = Time([&] {
+		Compose(pointsSoA, rotationsSoA, scalesSoA, out.data(), MATRIX_COUNT);
+		gSink = out[MATRIX_COUNT / 2].m0;
+	});
+
+	double pointsSingle = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			results[i] = a[0] * points[i];
+		gSink = results[MATRIX_COUNT / 2].x;
+	});
+	double pointsBatch = Time([&] {
+		Transform(a[0], pointsSoA, resultsSoA, MATRIX_COUNT);
+		gSink = rx[MATRIX_COUNT / 2];
+	});
+
+	double slerpSingle = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			slerps[i] = Slerp(rotations[i], targets[i], amounts[i]);
+		gSink = slerps[MATRIX_COUNT / 2].x;
+	});
+	double slerpBatch = Time([&] {
+		Slerp(rotationsSoA, targetsSoA, amounts.data(), slerpsSoA, MATRIX_COUNT);
+		gSink = ox[MATRIX_COUNT / 2];
+	});
+
+	double normalizeSingle = Time([&] {
+		for (int i = 0; i < MATRIX_COUNT; i++)
+			results[i] = Normalize(points[i]);
+		gSink = results[MATRIX_COUNT / 2].x;
+	});
+	double normalizeBatch = Time([&] {
+		Normalize(pointsSoA, resultsSoA, MATRIX_COUNT);
+		gSink = rx[MATRIX_COUNT / 2];
+	});
+
+	printf("\nBatch (per object, single = one call per object):\n");
+	Report("Compose TRS", composeSingle, composeBatch);
+	Report("Transform points", pointsSingle, pointsBatch);
+	Report("Slerp", slerpSingle, slerpBatch);
+	Report("Normalize", normalizeSingle, normalizeBatch);
+	return 0;
+}
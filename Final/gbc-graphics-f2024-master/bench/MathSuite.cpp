@@ -0,0 +1,540 @@
+// Benchmark suite for the hot Math.h functions. Not part of the main project, build it on its own:
+//   g++ -O2 -DNDEBUG -I../src MathSuite.cpp -o MathSuite
+//
+// Every function has two variants:
+//   <name>/throughput  Calls on independent inputs, so the CPU overlaps them. Cost per call when there's lots of work.
+//   <name>/latency     Each call's input depends on the previous call's result. Cost of one call on the critical path.
+//                      ToMatrix and Perspective results don't feed back naturally, so their chains go through
+//                      an extra multiply-add (a few cycles).
+//
+// Options:
+//   --filter=<text>      Only run benchmarks whose name contains text
+//   --min-time=<s>       Minimum time per repetition (default 0.2)
+//   --repetitions=<n>    Repetitions per benchmark, the median is reported (default 5)
+//   --json=<path>        Write results as JSON (same layout as Google Benchmark, so its compare.py works too)
+//   --baseline=<path>    Compare against JSON written by an earlier run
+//
+// ie save a baseline before a vectorization or layout change, then compare after it:
+//   ./MathSuite --json=before.json
+//   ./MathSuite --baseline=before.json
+#include "Math.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Power of two so indices wrap with a mask. Inputs and outputs fit in L1/L2 so we measure math, not memory.
+constexpr int INPUT_COUNT = 256;
+constexpr int INPUT_MASK = INPUT_COUNT - 1;
+
+// Makes the compiler assume value is used, so the work producing it can't be removed
+template<typename T>
+static void DoNotOptimize(T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	asm volatile("" : "+m"(value) : : "memory");
+#else
+	static volatile char sink;
+	sink = *(volatile char*)&value;
+#endif
+}
+
+struct Inputs
+{
+	std::vector<Matrix> worlds;			// Scale * rotation * translation
+	std::vector<Matrix> rotations;		// Orthonormal, so products of them stay bounded
+	std::vector<Affine> affineWorlds;	// Same as worlds and rotations
+	std::vector<Affine> affineRotations;
+	std::vector<Vector3> points;
+	std::vector<Quaternion> quaternions;	// Unit length
+	std::vector<float> amounts;			// [0, 1]
+};
+
+struct Outputs
+{
+	Matrix matrices[INPUT_COUNT];
+	Affine affines[INPUT_COUNT];
+	Vector3 vectors[INPUT_COUNT];
+	Quaternion quaternions[INPUT_COUNT];
+};
+
+static Inputs gIn;
+static Outputs gOut;
+
+static void CreateInputs()
+{
+	srand(1);
+	for (int i = 0; i < INPUT_COUNT; i++)
+	{
+		Vector3 angles = { Random(-PI, PI), Random(-PI, PI), Random(-PI, PI) };
+		Vector3 scale = { Random(0.5f, 2.0f), Random(0.5f, 2.0f), Random(0.5f, 2.0f) };
+		Vector3 translation = { Random(-10.0f, 10.0f), Random(-10.0f, 10.0f), Random(-10.0f, 10.0f) };
+		gIn.rotations.push_back(RotateXYZ(angles));
+		gIn.worlds.push_back(Scale(scale) * RotateXYZ(angles) * Translate(translation));
+		gIn.affineWorlds.push_back(ToAffine(gIn.worlds.back()));
+		gIn.affineRotations.push_back(ToAffine(gIn.rotations.back()));
+		gIn.points.push_back(translation);
+		gIn.quaternions.push_back(FromEuler(angles));
+		gIn.amounts.push_back(Random(0.0f, 1.0f));
+	}
+}
+
+struct Benchmark
+{
+	const char* name;
+	void (*run)(int64_t iterations);
+};
+
+// Both variants of each function. Throughput writes to gOut, latency chains through a local.
+static const Benchmark BENCHMARKS[] =
+{
+	{ "Multiply/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.matrices[i] = Multiply(gIn.worlds[i], gIn.rotations[i]);
+		}
+	} },
+	{ "Multiply/latency", [](int64_t n) {
+		Matrix m = gIn.rotations[0];
+		for (int64_t k = 0; k < n; k++)
+			m = Multiply(m, gIn.rotations[k & INPUT_MASK]);
+		DoNotOptimize(m);
+	} },
+
+	{ "Invert/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.matrices[i] = Invert(gIn.worlds[i]);
+		}
+	} },
+	{ "Invert/latency", [](int64_t n) {
+		Matrix m = gIn.worlds[0];
+		for (int64_t k = 0; k < n; k++)
+			m = Invert(m);
+		DoNotOptimize(m);
+	} },
+
+	{ "Transpose/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.matrices[i] = Transpose(gIn.worlds[i]);
+		}
+	} },
+	{ "Transpose/latency", [](int64_t n) {
+		Matrix m = gIn.worlds[0];
+		for (int64_t k = 0; k < n; k++)
+		{
+			m = Transpose(m);
+			DoNotOptimize(m);	// Otherwise pairs of transposes cancel out
+		}
+	} },
+
+	{ "NormalMatrix/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.matrices[i] = NormalMatrix(gIn.worlds[i]);
+		}
+	} },
+	{ "NormalMatrix/latency", [](int64_t n) {
+		Matrix m = gIn.worlds[0];
+		for (int64_t k = 0; k < n; k++)
+			m = NormalMatrix(m);
+		DoNotOptimize(m);
+	} },
+
+	{ "AffineMultiply/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.affines[i] = Multiply(gIn.affineWorlds[i], gIn.affineRotations[i]);
+		}
+	} },
+	{ "AffineMultiply/latency", [](int64_t n) {
+		Affine m = gIn.affineRotations[0];
+		for (int64_t k = 0; k < n; k++)
+			m = Multiply(m, gIn.affineRotations[k & INPUT_MASK]);
+		DoNotOptimize(m);
+	} },
+
+	{ "AffineInvert/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.affines[i] = Invert(gIn.affineWorlds[i]);
+		}
+	} },
+	{ "AffineInvert/latency", [](int64_t n) {
+		Affine m = gIn.affineWorlds[0];
+		for (int64_t k = 0; k < n; k++)
+			m = Invert(m);
+		DoNotOptimize(m);
+	} },
+
+	{ "AffineNormalMatrix/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.affines[i] = NormalMatrix(gIn.affineWorlds[i]);
+		}
+	} },
+	{ "AffineNormalMatrix/latency", [](int64_t n) {
+		Affine m = gIn.affineWorlds[0];
+		for (int64_t k = 0; k < n; k++)
+			m = NormalMatrix(m);
+		DoNotOptimize(m);
+	} },
+
+	{ "LookAt/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.matrices[i] = LookAt(gIn.points[i], V3_ZERO, V3_UP);
+		}
+	} },
+	{ "LookAt/latency", [](int64_t n) {
+		// The view matrix's translation is the eye rotated into view-space, so its length never changes
+		Vector3 eye = gIn.points[0];
+		for (int64_t k = 0; k < n; k++)
+			eye = Translation(LookAt(eye, V3_ZERO, V3_UP));
+		DoNotOptimize(eye);
+	} },
+
+	{ "Perspective/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.matrices[i] = Perspective(0.5 + gIn.amounts[i], 16.0 / 9.0, 0.1, 100.0);
+		}
+	} },
+	{ "Perspective/latency", [](int64_t n) {
+		double fovy = 1.0;
+		for (int64_t k = 0; k < n; k++)
+			fovy = 1.0 + Perspective(fovy, 16.0 / 9.0, 0.1, 100.0).m5 * 0.001;
+		DoNotOptimize(fovy);
+	} },
+
+	{ "FromEuler/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.quaternions[i] = FromEuler(gIn.points[i]);
+		}
+	} },
+	{ "FromEuler/latency", [](int64_t n) {
+		Quaternion q = gIn.quaternions[0];
+		for (int64_t k = 0; k < n; k++)
+			q = FromEuler(q.x, q.y, q.z);
+		DoNotOptimize(q);
+	} },
+
+	{ "ToMatrix/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.matrices[i] = ToMatrix(gIn.quaternions[i]);
+		}
+	} },
+	{ "ToMatrix/latency", [](int64_t n) {
+		float feedback = 0.0f;
+		for (int64_t k = 0; k < n; k++)
+		{
+			Quaternion q = gIn.quaternions[k & INPUT_MASK];
+			q.x += feedback;
+			feedback = ToMatrix(q).m5 * 1e-30f;	// m5 depends on q.x
+		}
+		DoNotOptimize(feedback);
+	} },
+
+	{ "Slerp/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.quaternions[i] = Slerp(gIn.quaternions[i], gIn.quaternions[(i + 1) & INPUT_MASK], gIn.amounts[i]);
+		}
+	} },
+	{ "Slerp/latency", [](int64_t n) {
+		Quaternion q = gIn.quaternions[0];
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			q = Slerp(q, gIn.quaternions[i], gIn.amounts[i]);
+		}
+		DoNotOptimize(q);
+	} },
+
+	{ "Normalize/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.vectors[i] = Normalize(gIn.points[i]);
+		}
+	} },
+	{ "Normalize/latency", [](int64_t n) {
+		Vector3 v = gIn.points[0];
+		for (int64_t k = 0; k < n; k++)
+			v = Normalize(v);
+		DoNotOptimize(v);
+	} },
+
+	{ "RotateQuaternion/throughput", [](int64_t n) {
+		for (int64_t k = 0; k < n; k++)
+		{
+			int i = (int)(k & INPUT_MASK);
+			gOut.vectors[i] = Rotate(gIn.points[i], gIn.quaternions[i]);
+		}
+	} },
+	{ "RotateQuaternion/latency", [](int64_t n) {
+		Vector3 v = gIn.points[0];
+		for (int64_t k = 0; k < n; k++)
+			v = Rotate(v, gIn.quaternions[k & INPUT_MASK]);
+		DoNotOptimize(v);
+	} },
+};
+
+struct Result
+{
+	std::string name;
+	int64_t iterations = 0;
+	double realTime = 0.0;	// Nanoseconds per call
+	double cpuTime = 0.0;
+};
+
+struct Options
+{
+	const char* filter = "";
+	const char* jsonPath = nullptr;
+	const char* baselinePath = nullptr;
+	double minTime = 0.2;
+	int repetitions = 5;
+};
+
+// Seconds of wall and CPU time spent running iterations calls
+static void Time(const Benchmark& benchmark, int64_t iterations, double* real, double* cpu)
+{
+	std::clock_t cpuStart = std::clock();
+	auto realStart = std::chrono::steady_clock::now();
+	benchmark.run(iterations);
+	DoNotOptimize(gOut);	// Nothing reads gOut, so the throughput loops would be removed without this
+	auto realEnd = std::chrono::steady_clock::now();
+	std::clock_t cpuEnd = std::clock();
+
+	*real = std::chrono::duration<double>(realEnd - realStart).count();
+	*cpu = (cpuEnd - cpuStart) / (double)CLOCKS_PER_SEC;
+}
+
+static Result Run(const Benchmark& benchmark, const Options& options)
+{
+	// Grow the iteration count until one repetition takes at least minTime
+	int64_t iterations = 1;
+	double real = 0.0, cpu = 0.0;
+	while (true)
+	{
+		Time(benchmark, iterations, &real, &cpu);
+		if (real >= options.minTime)
+			break;
+		if (iterations > 1000000000000ll)
+		{
+			printf("**Warning: %s takes no time, the compiler removed its work**\n", benchmark.name);
+			break;
+		}
+
+		double scale = real > 0.0 ? options.minTime / real * 1.4 : 10.0;
+		iterations = (int64_t)(iterations * std::min(std::max(scale, 2.0), 10.0));
+	}
+
+	// Median of the repetitions
+	std::vector<double> reals, cpus;
+	for (int i = 0; i < options.repetitions; i++)
+	{
+		Time(benchmark, iterations, &real, &cpu);
+		reals.push_back(real);
+		cpus.push_back(cpu);
+	}
+	std::sort(reals.begin(), reals.end());
+	std::sort(cpus.begin(), cpus.end());
+
+	Result result;
+	result.name = benchmark.name;
+	result.iterations = iterations;
+	result.realTime = reals[reals.size() / 2] * 1e9 / iterations;
+	result.cpuTime = cpus[cpus.size() / 2] * 1e9 / iterations;
+	return result;
+}
+
+static const char* GetPath()
+{
+#if defined(MATH_SSE)
+	return "SSE";
+#elif defined(MATH_NEON)
+	return "NEON";
+#else
+	return "scalar";
+#endif
+}
+
+static void WriteJson(const char* path, const char* executable, const Options& options, const std::vector<Result>& results)
+{
+	FILE* file = fopen(path, "w");
+	if (file == nullptr)
+	{
+		printf("**Error: could not write %s**\n", path);
+		return;
+	}
+
+	char date[64];
+	std::time_t now = std::time(nullptr);
+	std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+	fprintf(file, "{\n");
+	fprintf(file, "  \"context\": {\n");
+	fprintf(file, "    \"date\": \"%s\",\n", date);
+	fprintf(file, "    \"executable\": \"%s\",\n", executable);
+	fprintf(file, "    \"num_cpus\": %u,\n", std::thread::hardware_concurrency());
+	fprintf(file, "    \"math_path\": \"%s\",\n", GetPath());
+#ifdef NDEBUG
+	fprintf(file, "    \"library_build_type\": \"release\"\n");
+#else
+	fprintf(file, "    \"library_build_type\": \"debug\"\n");
+#endif
+	fprintf(file, "  },\n");
+	fprintf(file, "  \"benchmarks\": [\n");
+	for (size_t i = 0; i < results.size(); i++)
+	{
+		const Result& result = results[i];
+		fprintf(file, "    {\n");
+		fprintf(file, "      \"name\": \"%s\",\n", result.name.c_str());
+		fprintf(file, "      \"run_name\": \"%s\",\n", result.name.c_str());
+		fprintf(file, "      \"run_type\": \"iteration\",\n");
+		fprintf(file, "      \"repetitions\": %d,\n", options.repetitions);
+		fprintf(file, "      \"threads\": 1,\n");
+		fprintf(file, "      \"iterations\": %lld,\n", (long long)result.iterations);
+		fprintf(file, "      \"real_time\": %.4f,\n", result.realTime);
+		fprintf(file, "      \"cpu_time\": %.4f,\n", result.cpuTime);
+		fprintf(file, "      \"time_unit\": \"ns\",\n");
+		fprintf(file, "      \"items_per_second\": %.1f\n", 1e9 / result.realTime);
+		fprintf(file, "    }%s\n", i + 1 < results.size() ? "," : "");
+	}
+	fprintf(file, "  ]\n");
+	fprintf(file, "}\n");
+	fclose(file);
+	printf("Wrote %s\n", path);
+}
+
+// Reads name/real_time pairs back out of JSON written by WriteJson (or Google Benchmark)
+static std::vector<Result> ReadJson(const char* path)
+{
+	std::vector<Result> results;
+	FILE* file = fopen(path, "rb");
+	if (file == nullptr)
+	{
+		printf("**Error: could not read %s**\n", path);
+		return results;
+	}
+
+	std::string json;
+	char buffer[4096];
+	size_t read;
+	while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+		json.append(buffer, read);
+	fclose(file);
+
+	size_t position = 0;
+	while ((position = json.find("\"name\": \"", position)) != std::string::npos)
+	{
+		position += strlen("\"name\": \"");
+		size_t end = json.find('"', position);
+		size_t time = json.find("\"real_time\": ", end);
+		if (end == std::string::npos || time == std::string::npos)
+			break;
+
+		Result result;
+		result.name = json.substr(position, end - position);
+		result.realTime = atof(json.c_str() + time + strlen("\"real_time\": "));
+		results.push_back(result);
+		position = time;
+	}
+	return results;
+}
+
+static void Compare(const char* baselinePath, const std::vector<Result>& results)
+{
+	std::vector<Result> baseline = ReadJson(baselinePath);
+	printf("\nCompared to %s (negative is faster):\n", baselinePath);
+	printf("%-32s %12s %12s %9s\n", "Benchmark", "Baseline ns", "Current ns", "Change");
+	for (const Result& result : results)
+	{
+		auto match = std::find_if(baseline.begin(), baseline.end(), [&](const Result& other) { return other.name == result.name; });
+		if (match == baseline.end())
+		{
+			printf("%-32s %12s %12.2f %9s\n", result.name.c_str(), "-", result.realTime, "new");
+			continue;
+		}
+
+		double change = (result.realTime - match->realTime) / match->realTime * 100.0;
+		printf("%-32s %12.2f %12.2f %+8.1f%%\n", result.name.c_str(), match->realTime, result.realTime, change);
+	}
+}
+
+static bool ParseOption(const char* arg, const char* name, const char** value)
+{
+	size_t length = strlen(name);
+	if (strncmp(arg, name, length) != 0 || arg[length] != '=')
+		return false;
+	*value = arg + length + 1;
+	return true;
+}
+
+int main(int argc, char** argv)
+{
+	Options options;
+	for (int i = 1; i < argc; i++)
+	{
+		const char* value = nullptr;
+		if (ParseOption(argv[i], "--filter", &value))
+			options.filter = value;
+		else if (ParseOption(argv[i], "--json", &value))
+			options.jsonPath = value;
+		else if (ParseOption(argv[i], "--baseline", &value))
+			options.baselinePath = value;
+		else if (ParseOption(argv[i], "--min-time", &value))
+			options.minTime = atof(value);
+		else if (ParseOption(argv[i], "--repetitions", &value))
+			options.repetitions = std::max(1, atoi(value));
+		else
+		{
+			printf("Unknown option %s (see the top of MathSuite.cpp)\n", argv[i]);
+			return 1;
+		}
+	}
+
+	CreateInputs();
+	printf("Math path: %s\n", GetPath());
+	printf("%-32s %12s %12s %14s %12s\n", "Benchmark", "Time ns", "CPU ns", "Iterations", "Items/s");
+
+	std::vector<Result> results;
+	for (const Benchmark& benchmark : BENCHMARKS)
+	{
+		if (strstr(benchmark.name, options.filter) == nullptr)
+			continue;
+
+		Result result = Run(benchmark, options);
+		printf("%-32s %12.2f %12.2f %14lld %11.1fM\n", result.name.c_str(), result.realTime, result.cpuTime,
+			(long long)result.iterations, 1e3 / result.realTime);
+		results.push_back(result);
+	}
+
+	if (options.jsonPath != nullptr)
+		WriteJson(options.jsonPath, argv[0], options, results);
+	if (options.baselinePath != nullptr)
+		Compare(options.baselinePath, results);
+	return 0;
+}
@@ -0,0 +1,157 @@
+// Renders the main scene (object 1) with the software rasterizer in SoftRaster.h and times it, no GL context needed.
+// Not part of the main project, build it on its own and run it from the project directory so ./assets is found:
+//   MSVC:     cl /O2 /EHsc /Isrc /Iinc bench\SoftBench.cpp src\SoftRaster.cpp src\MeshData.cpp src\MeshCache.cpp src\ThreadPool.cpp src\Png.cpp src\FrameStats.cpp
+//   GCC/Clang: g++ -O2 -Isrc -Iinc bench/SoftBench.cpp src/SoftRaster.cpp src/MeshData.cpp src/MeshCache.cpp src/ThreadPool.cpp
+//              src/Png.cpp src/FrameStats.cpp -o SoftBench -pthread
+//   CMake:    the SoftBench target in CMakeLists.txt
+// Nothing here links glad, EGL or any other GL library, so it runs on machines that have none.
+//
+// Options (same as main's headless mode where they overlap):
+//   --frames N     Frames to render (default 600), animated with main's fixed headless timestep
+//   --png path     Save the final frame
+//   --threads N    Rasterizer threads besides the main thread (default one per core, minus one)
+//
+// Draws the spheres whose shaders have software versions. Reflection, refraction and the skybox are left out,
+// and the light gizmos are filled with uniform_color since there's no line mode.
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#include "FrameStats.h"
+#include "Mesh.h"
+#include "Png.h"
+#include "SoftRaster.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+constexpr int SCREEN_WIDTH = 1280;
+constexpr int SCREEN_HEIGHT = 720;
+constexpr float SCREEN_ASPECT = SCREEN_WIDTH / (float)SCREEN_HEIGHT;
+constexpr float HEADLESS_DT = 1.0f / 60.0f;
+
+int main(int argc, char** argv)
+{
+	int frames = 600;
+	int threads = 0;
+	const char* pngPath = nullptr;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+			frames = atoi(argv[++i]);
+		else if (strcmp(argv[i], "--png") == 0 && i + 1 < argc)
+			pngPath = argv[++i];
+		else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+			threads = atoi(argv[++i]);
+	}
+	if (frames <= 0)
+	{
+		printf("--frames must be a positive number of frames\n");
+		return EXIT_FAILURE;
+	}
+
+	Mesh sphereMesh;
+	LoadMesh(&sphereMesh, "assets/meshes/uvsphere.obj", INTERLEAVED);
+	SoftTexture backgroundTexture;
+	LoadSoftTexture(&backgroundTexture, "./assets/textures/water_Color.jpg");
+
+	SoftRenderer renderer;
+	CreateSoftRenderer(&renderer, SCREEN_WIDTH, SCREEN_HEIGHT, threads);
+	printf("Software rasterizer: %i threads, %ix%i tiles\n", (int)renderer.pool.threads.size() + 1, renderer.tilesX, renderer.tilesY);
+
+	// Camera and lights as main.cpp sets them up, before any input
+	Vector3 cameraPos = { 0.0f, 0.0f, 3.0f };
+	Vector3 cameraDir = { 0.0f, 0.0f, 1.0f };
+	float fov = 75.0f * DEG2RAD;
+	float near = 0.01f;
+	float far = 10.0f;
+	Vector3 lightColor = { 1.0f, 1.0f, 1.0f };
+	float lightRadius = 1.0f;
+	Vector3 lightColorSpot = { 1.0f, 1.0f, 1.0f };
+	float lightRadiusSpot = 12.0f;
+
+	std::vector<float> frameTimes;
+	frameTimes.reserve(frames);
+	int visibleObjects = 0;
+	int culledObjects = 0;
+	for (int frameIndex = 0; frameIndex < frames; frameIndex++)
+	{
+		std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+		visibleObjects = culledObjects = 0;
+		float time = frameIndex * HEADLESS_DT;
+		float texScrolling = time / 8;
+
+		Matrix view = LookAt(cameraPos, cameraPos - cameraDir, V3_UP);
+		Matrix proj = Perspective(fov, SCREEN_ASPECT, near, far);
+		ViewFrustum frustum = ToViewFrustum(view * proj);
+
+		Vector3 pointLightSpherePosition = { 1.5f * sinf(time - 14.66f), 0.0f, 1.5f * cosf(time - 14.66f) };
+		Vector3 spotLightSpherePosition = { 1.5f * sinf(time - 29.32f), 0.0f, 1.5f * cosf(time - 29.32f) };
+		Vector3 rotatedPointLightPosition = RotateZ(60 * DEG2RAD) * pointLightSpherePosition;
+		Vector3 rotatedSpotLightPosition = RotateZ(150 * DEG2RAD) * spotLightSpherePosition;
+
+		FrameData frameData;
+		frameData.view = ToFloat16(view);
+		frameData.proj = ToFloat16(proj);
+		frameData.viewProj = ToFloat16(view * proj);
+		frameData.cameraPosition = cameraPos;
+		frameData.lights[LIGHT_POINT].position = rotatedPointLightPosition;
+		frameData.lights[LIGHT_POINT].color = lightColor;
+		frameData.lights[LIGHT_POINT].radius = lightRadius;
+		frameData.lights[LIGHT_SPOT].position = rotatedSpotLightPosition;
+		frameData.lights[LIGHT_SPOT].color = lightColorSpot;
+		frameData.lights[LIGHT_SPOT].direction = Normalize(rotatedSpotLightPosition * -1);
+		frameData.lights[LIGHT_SPOT].radius = lightRadiusSpot;
+		BeginSoftFrame(&renderer, frameData);
+
+		Vector3 tcoordsSpherePosition = { 1.5f * sinf(time), 0.0f, 1.5f * cosf(time) };
+		Vector3 normalSpherePosition = { 1.5f * sinf(time - 7.33f), 0.0f, 1.5f * cosf(time - 7.33f) };
+
+		SoftDraw draws[5];
+		draws[0].shader = SOFT_TEXTURE_WITH_LIGHT;
+		draws[0].world = AffineTranslate(0.0f, 0.0f, 0.0f);
+		draws[0].texture = &backgroundTexture;
+		draws[0].texScrolling = texScrolling;
+
+		draws[1].shader = SOFT_TCOORD_COLOR;
+		draws[1].world = AffineTranslate(tcoordsSpherePosition);
+
+		draws[2].shader = SOFT_NORMAL_COLOR;
+		draws[2].world = AffineTranslate(normalSpherePosition) * AffineRotateZ(30 * DEG2RAD);
+
+		draws[3].shader = SOFT_UNIFORM_COLOR;
+		draws[3].world = AffineScale(V3_ONE * lightRadius) * AffineTranslate(pointLightSpherePosition) * AffineRotateZ(60 * DEG2RAD);
+		draws[3].color = lightColor;
+
+		draws[4].shader = SOFT_UNIFORM_COLOR;
+		draws[4].world = AffineTranslate(rotatedSpotLightPosition);
+		draws[4].color = lightColor;
+
+		for (SoftDraw& draw : draws)
+		{
+			draw.mesh = &sphereMesh;
+			draw.normal = NormalMatrix(draw.world);
+			if (IsInFrustum(sphereMesh, draw.world, frustum))
+			{
+				Submit(&renderer, draw);
+				visibleObjects++;
+			}
+			else
+			{
+				culledObjects++;
+			}
+		}
+		EndSoftFrame(&renderer);
+
+		frameTimes.push_back(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+	}
+
+	PrintFrameStats(frameTimes);
+	printf("Last frame: %i draws, %i triangles, %i objects visible, %i culled\n",
+		(int)renderer.draws.size(), (int)renderer.triangles.size(), visibleObjects, culledObjects);
+	if (pngPath != nullptr && WritePng(pngPath, renderer.width, renderer.height, (const uint8_t*)renderer.color.data()))
+		printf("Saved final frame to %s\n", pngPath);
+
+	DestroySoftRenderer(&renderer);
+	return 0;
+}
@@ -0,0 +1,218 @@
+#include "AssetLoader.h"
+#include "State.h"
+#include <stb_image.h>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+using Pixels = std::shared_ptr<stbi_uc>;
+
+static void Enqueue(AssetLoader* loader, std::function<void()> upload)
+{
+	std::lock_guard<std::mutex> lock(loader->mutex);
+	loader->uploads.push_back(std::move(upload));
+}
+
+// Decodes on the calling thread. Images are flipped per-thread so workers don't race on stb's global flag.
+static Pixels Decode(const char* path, bool flip, int* width, int* height, int* channels)
+{
+	stbi_set_flip_vertically_on_load_thread(flip);
+	stbi_uc* pixels = stbi_load(path, width, height, channels, 0);
+	if (pixels == nullptr)
+		printf("**Warning: failed to load image %s (%s)**\n", path, stbi_failure_reason());
+	return Pixels(pixels, stbi_image_free);
+}
+
+static GLenum GetFormat(int channels)
+{
+	switch (channels)
+	{
+	case 1:
+		return GL_RED;
+
+	case 2:
+		return GL_RG;
+
+	case 3:
+		return GL_RGB;
+
+	default:
+		return GL_RGBA;
+	}
+}
+
+// Sized format for immutable storage (glTexStorage*)
+static GLenum GetInternalFormat(int channels)
+{
+	switch (channels)
+	{
+	case 1:
+		return GL_R8;
+
+	case 2:
+		return GL_RG8;
+
+	case 3:
+		return GL_RGB8;
+
+	default:
+		return GL_RGBA8;
+	}
+}
+
+void CreateAssetLoader(AssetLoader* loader, int threadCount)
+{
+	CreateThreadPool(&loader->pool, threadCount);
+}
+
+void DestroyAssetLoader(AssetLoader* loader)
+{
+	// Let in-flight jobs finish since they write to memory we don't own, then drop their uploads
+	DestroyThreadPool(&loader->pool);
+	loader->uploads.clear();
+	loader->pending = 0;
+}
+
+void LoadMeshAsync(AssetLoader* loader, Mesh* mesh, const char* path, VertexLayout layout)
+{
+	loader->pending++;
+	std::string file = path;
+	Submit(&loader->pool, [loader, mesh, file, layout]
+	{
+		// Loaded into a separate mesh, so the caller's (culled and drawn meanwhile) is only ever written on the GL thread
+		std::shared_ptr<Mesh> loaded = std::make_shared<Mesh>();
+		LoadMesh(loaded.get(), file.c_str(), layout);
+		Enqueue(loader, [mesh, loaded]
+		{
+			*mesh = std::move(*loaded);
+			Upload(mesh);
+		});
+	});
+}
+
+void LoadTextureAsync(AssetLoader* loader, GLuint* texture, const char* path, GLint wrap, bool flip)
+{
+	loader->pending++;
+	std::string file = path;
+	Submit(&loader->pool, [loader, texture, file, wrap, flip]
+	{
+		int width = 0, height = 0, channels = 0;
+		Pixels pixels = Decode(file.c_str(), flip, &width, &height, &channels);
+		Enqueue(loader, [texture, pixels, width, height, channels, wrap]
+		{
+			if (pixels == nullptr)
+				return;
+
+			GLenum format = GetFormat(channels);
+			glGenTextures(1, texture);
+			BindTexture(GL_TEXTURE_2D, *texture);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrap);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, wrap);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, pixels.get());
+			BindTexture(GL_TEXTURE_2D, GL_NONE);
+		});
+	});
+}
+
+void LoadCubemapAsync(AssetLoader* loader, GLuint* texture, const char* const paths[6])
+{
+	struct Face
+	{
+		std::string path;
+		Pixels pixels;
+		int width = 0, height = 0, channels = 0;
+	};
+
+	struct Cubemap
+	{
+		std::array<Face, 6> faces;
+		std::atomic<int> remaining{ 6 };
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+	};
+
+	loader->pending++;
+	std::shared_ptr<Cubemap> cubemap = std::make_shared<Cubemap>();
+	for (int i = 0; i < 6; i++)
+		cubemap->faces[i].path = paths[i];
+
+	// Decode every face on its own worker. Whichever finishes last queues the upload.
+	for (int i = 0; i < 6; i++)
+	{
+		Submit(&loader->pool, [loader, texture, cubemap, i]
+		{
+			// Cubemap faces are not flipped
+			Face& face = cubemap->faces[i];
+			face.pixels = Decode(face.path.c_str(), false, &face.width, &face.height, &face.channels);
+			if (--cubemap->remaining > 0)
+				return;
+
+			double decodeTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cubemap->start).count();
+			printf("Cubemap decoded in %.2fms\n", decodeTime);
+
+			Enqueue(loader, [texture, cubemap]
+			{
+				// Every face of a cubemap must have the same size and format
+				const Face& first = cubemap->faces[0];
+				for (const Face& face : cubemap->faces)
+				{
+					if (face.pixels == nullptr || face.width != first.width || face.height != first.height || face.channels != first.channels)
+					{
+						printf("**Warning: cubemap faces are missing or don't match (%s)**\n", face.path.c_str());
+						return;
+					}
+				}
+
+				// Allocate every face at once, then fill them in
+				GLenum format = GetFormat(first.channels);
+				glGenTextures(1, texture);
+				BindTexture(GL_TEXTURE_CUBE_MAP, *texture);
+				glTexStorage2D(GL_TEXTURE_CUBE_MAP, 1, GetInternalFormat(first.channels), first.width, first.height);
+				for (int i = 0; i < 6; i++)
+					glTexSubImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, 0, 0, first.width, first.height, format, GL_UNSIGNED_BYTE, cubemap->faces[i].pixels.get());
+				glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+				glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+				glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
+				glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+				glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+				BindTexture(GL_TEXTURE_CUBE_MAP, GL_NONE);
+
+				double uploadTime = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - cubemap->start).count();
+				printf("Cubemap uploaded %.2fms after it was requested\n", uploadTime);
+			});
+		});
+	}
+}
+
+void UpdateAssetLoader(AssetLoader* loader, double budget)
+{
+	using Clock = std::chrono::steady_clock;
+	Clock::time_point start = Clock::now();
+	do
+	{
+		std::function<void()> upload;
+		{
+			std::lock_guard<std::mutex> lock(loader->mutex);
+			if (loader->uploads.empty())
+				return;
+
+			upload = std::move(loader->uploads.front());
+			loader->uploads.pop_front();
+		}
+		upload();
+		loader->pending--;
+	} while (std::chrono::duration<double, std::milli>(Clock::now() - start).count() < budget);
+}
+
+void WaitForAssets(AssetLoader* loader)
+{
+	while (IsLoading(*loader))
+	{
+		UpdateAssetLoader(loader, 1000.0);
+		std::this_thread::sleep_for(std::chrono::milliseconds(1));
+	}
+}
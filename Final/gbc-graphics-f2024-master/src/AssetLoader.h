@@ -0,0 +1,36 @@
+#pragma once
+#include <glad/glad.h>
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include "Mesh.h"
+#include "ThreadPool.h"
+
+// Parses meshes and decodes images on a thread pool, then hands the results to the GL thread to upload.
+// Every Mesh and GLuint passed in must outlive the loader, and is only written on the GL thread by UpdateAssetLoader.
+struct AssetLoader
+{
+	ThreadPool pool;
+
+	// Finished CPU work waiting for its GL calls
+	std::deque<std::function<void()>> uploads;
+	std::mutex mutex;
+
+	std::atomic<int> pending{ 0 };	// Assets submitted but not yet uploaded
+};
+
+void CreateAssetLoader(AssetLoader* loader, int threadCount = 0);
+void DestroyAssetLoader(AssetLoader* loader);
+
+void LoadMeshAsync(AssetLoader* loader, Mesh* mesh, const char* path, VertexLayout layout = SEPARATE);
+void LoadTextureAsync(AssetLoader* loader, GLuint* texture, const char* path, GLint wrap = GL_REPEAT, bool flip = true);
+void LoadCubemapAsync(AssetLoader* loader, GLuint* texture, const char* const paths[6]);
+
+// Runs queued uploads on the GL thread until budget milliseconds have passed. Always runs at least one.
+void UpdateAssetLoader(AssetLoader* loader, double budget);
+
+// Blocks until every submitted asset is uploaded
+void WaitForAssets(AssetLoader* loader);
+
+inline bool IsLoading(const AssetLoader& loader) { return loader.pending > 0; }
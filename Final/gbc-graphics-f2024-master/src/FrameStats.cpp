@@ -0,0 +1,24 @@
+#include "FrameStats.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+void PrintFrameStats(std::vector<float> frameTimes)
+{
+	if (frameTimes.empty())
+		return;
+
+	std::sort(frameTimes.begin(), frameTimes.end());
+	size_t count = frameTimes.size();
+	size_t p99 = (size_t)std::ceil(count * 0.99) - 1;
+	float sum = 0.0f;
+	for (float time : frameTimes)
+		sum += time;
+
+	printf("Frames: %zu\n", count);
+	printf("Min:    %.3fms\n", frameTimes.front());
+	printf("Median: %.3fms\n", frameTimes[count / 2]);
+	printf("Mean:   %.3fms\n", sum / count);
+	printf("P99:    %.3fms\n", frameTimes[p99]);
+	printf("Max:    %.3fms\n", frameTimes.back());
+}
@@ -0,0 +1,5 @@
+#pragma once
+#include <vector>
+
+// Prints min/median/mean/p99/max of the given frame times in milliseconds
+void PrintFrameStats(std::vector<float> frameTimes);
@@ -0,0 +1,134 @@
+#include "Headless.h"
+#include "Png.h"
+#ifdef __linux__
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#ifdef __linux__
+bool CreateHeadlessContext(HeadlessContext* headless, int width, int height)
+{
+	// Prefer Mesa's surfaceless platform since it never needs a display server
+	EGLDisplay display = EGL_NO_DISPLAY;
+	PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (getPlatformDisplay != nullptr)
+		display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+	if (display == EGL_NO_DISPLAY)
+		display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+
+	EGLint major, minor;
+	if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor) || !eglBindAPI(EGL_OPENGL_API))
+	{
+		printf("Headless: failed to initialize EGL (0x%x)\n", eglGetError());
+		return false;
+	}
+
+	// We target 4.6, but llvmpipe stops at 4.5
+	EGLContext context = EGL_NO_CONTEXT;
+	for (EGLint version : { 6, 5 })
+	{
+		EGLint attributes[] =
+		{
+			EGL_CONTEXT_MAJOR_VERSION, 4,
+			EGL_CONTEXT_MINOR_VERSION, version,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+#ifndef NDEBUG
+			EGL_CONTEXT_OPENGL_DEBUG, EGL_TRUE,
+#endif
+			EGL_NONE
+		};
+		context = eglCreateContext(display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+		if (context != EGL_NO_CONTEXT)
+			break;
+	}
+
+	if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+	{
+		printf("Headless: failed to create an OpenGL 4.5+ core context (0x%x)\n", eglGetError());
+		eglTerminate(display);
+		return false;
+	}
+
+	if (!gladLoadGLLoader((GLADloadproc)eglGetProcAddress))
+	{
+		printf("Headless: failed to load OpenGL\n");
+		eglDestroyContext(display, context);
+		eglTerminate(display);
+		return false;
+	}
+	printf("Headless: %s (%s)\n", glGetString(GL_VERSION), glGetString(GL_RENDERER));
+
+	headless->display = display;
+	headless->context = context;
+	headless->width = width;
+	headless->height = height;
+
+	glGenRenderbuffers(1, &headless->color);
+	glBindRenderbuffer(GL_RENDERBUFFER, headless->color);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+
+	glGenRenderbuffers(1, &headless->depth);
+	glBindRenderbuffer(GL_RENDERBUFFER, headless->depth);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, width, height);
+	glBindRenderbuffer(GL_RENDERBUFFER, GL_NONE);
+
+	glGenFramebuffers(1, &headless->fbo);
+	glBindFramebuffer(GL_FRAMEBUFFER, headless->fbo);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, headless->color);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, headless->depth);
+	if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+	{
+		printf("Headless: framebuffer is incomplete\n");
+		DestroyHeadlessContext(headless);
+		return false;
+	}
+	glViewport(0, 0, width, height);
+	return true;
+}
+
+void DestroyHeadlessContext(HeadlessContext* headless)
+{
+	if (headless->context == nullptr)
+		return;
+
+	glDeleteFramebuffers(1, &headless->fbo);
+	glDeleteRenderbuffers(1, &headless->color);
+	glDeleteRenderbuffers(1, &headless->depth);
+
+	eglMakeCurrent(headless->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	eglDestroyContext(headless->display, headless->context);
+	eglTerminate(headless->display);
+	*headless = HeadlessContext{};
+}
+#else
+bool CreateHeadlessContext(HeadlessContext* headless, int width, int height)
+{
+	printf("Headless: only supported on Linux (EGL)\n");
+	return false;
+}
+
+void DestroyHeadlessContext(HeadlessContext* headless)
+{
+}
+#endif
+
+bool SaveFramebuffer(const HeadlessContext& headless, const char* path)
+{
+	int width = headless.width;
+	int height = headless.height;
+	std::vector<uint8_t> pixels(width * height * 4);
+	glBindFramebuffer(GL_READ_FRAMEBUFFER, headless.fbo);
+	glPixelStorei(GL_PACK_ALIGNMENT, 1);
+	glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+	// OpenGL's first row is the bottom of the image, PNG's is the top
+	std::vector<uint8_t> flipped(pixels.size());
+	size_t stride = width * 4;
+	for (int y = 0; y < height; y++)
+		std::copy_n(&pixels[(height - 1 - y) * stride], stride, &flipped[y * stride]);
+
+	return WritePng(path, width, height, flipped.data());
+}
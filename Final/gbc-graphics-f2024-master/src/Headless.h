@@ -0,0 +1,24 @@
+#pragma once
+#include <glad/glad.h>
+
+// Offscreen OpenGL context that renders into an FBO instead of a window.
+// Uses EGL's surfaceless platform, so it runs on machines without a display or GPU (ie Mesa llvmpipe in CI).
+// Linux only; link with -lEGL. Elsewhere CreateHeadlessContext fails.
+struct HeadlessContext
+{
+	void* display = nullptr;	// EGLDisplay
+	void* context = nullptr;	// EGLContext
+
+	GLuint fbo = GL_NONE;
+	GLuint color = GL_NONE;	// RGBA8 renderbuffer
+	GLuint depth = GL_NONE;	// Depth-stencil renderbuffer
+	int width = 0;
+	int height = 0;
+};
+
+// Creates the context, loads GL through glad, then binds an FBO of the given size as the default target
+bool CreateHeadlessContext(HeadlessContext* headless, int width, int height);
+void DestroyHeadlessContext(HeadlessContext* headless);
+
+// Saves the FBO's color buffer as a PNG (see Png.h)
+bool SaveFramebuffer(const HeadlessContext& headless, const char* path);
@@ -23,6 +23,35 @@
 #define RAD2DEG (180.0f/PI)
 #endif
 
+// SIMD versions of Multiply(Matrix, Matrix), Invert(Matrix) and Matrix * Vector4, chosen at compile-time.
+// Define MATH_NO_SIMD before including to force the scalar versions (the *Scalar functions are always available).
+//
+// Tolerance versus the scalar versions:
+//  - Multiply and Matrix * Vector4 are bit-identical. Each lane does the same multiplies and adds in the same order.
+//    (This assumes the compiler doesn't contract the scalar code into FMAs, which MSVC and GCC don't by default on x86-64).
+//  - Invert uses a different (2x2 block) factorization, so results differ by rounding. Measured in ULPs of the
+//    largest element of each row: at most 8 ULP from scalar for well-conditioned matrices and 64 ULP for world
+//    matrices with scales from 0.1 to 10. That's the scalar version's own error against an exact inverse,
+//    so neither is more accurate. See bench/MathBench.cpp.
+//
+// Functions that only do arithmetic are constexpr, so constant transforms like Scale(2.0f, 2.0f, 2.0f) * Translate(V3_UP)
+// fold at compile-time (checked at the bottom of this file). Functions that need sqrtf, sinf etc aren't, since the
+// <cmath> functions aren't constexpr. Intrinsics can't run at compile-time either, so the SIMD functions use the
+// scalar versions while being constant-evaluated. Compilers that can't tell get the scalar versions everywhere.
+#if defined(__clang__) && __clang_major__ >= 9 || !defined(__clang__) && defined(__GNUC__) && __GNUC__ >= 9 || defined(_MSC_VER) && _MSC_VER >= 1925
+#define MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#elif !defined(MATH_NO_SIMD)
+#define MATH_NO_SIMD
+#endif
+
+#if !defined(MATH_NO_SIMD) && (defined(__SSE__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 1))
+#define MATH_SSE
+#include <xmmintrin.h>
+#elif !defined(MATH_NO_SIMD) && (defined(__ARM_NEON) || defined(_M_ARM64))
+#define MATH_NEON
+#include <arm_neon.h>
+#endif
+
 typedef struct float3 {
     float v[3]{};
 } float3;
@@ -47,57 +76,57 @@ struct Vector2 {
     float x;
     float y;
 
-    RMAPI Vector2 operator+=(Vector2 v);
-    RMAPI Vector2 operator-=(Vector2 v);
-    RMAPI Vector2 operator*=(Vector2 v);
-    RMAPI Vector2 operator/=(Vector2 v);
+    RMAPI constexpr Vector2 operator+=(Vector2 v);
+    RMAPI constexpr Vector2 operator-=(Vector2 v);
+    RMAPI constexpr Vector2 operator*=(Vector2 v);
+    RMAPI constexpr Vector2 operator/=(Vector2 v);
 
-    RMAPI Vector2 operator+=(float f);
-    RMAPI Vector2 operator-=(float f);
-    RMAPI Vector2 operator*=(float f);
-    RMAPI Vector2 operator/=(float f);
+    RMAPI constexpr Vector2 operator+=(float f);
+    RMAPI constexpr Vector2 operator-=(float f);
+    RMAPI constexpr Vector2 operator*=(float f);
+    RMAPI constexpr Vector2 operator/=(float f);
 
-    RMAPI operator Vector3() const;
+    RMAPI constexpr operator Vector3() const;
 };
 
-RMAPI Vector2 operator+(Vector2 a, Vector2 b);
-RMAPI Vector2 operator-(Vector2 a, Vector2 b);
-RMAPI Vector2 operator*(Vector2 a, Vector2 b);
-RMAPI Vector2 operator/(Vector2 a, Vector2 b);
+RMAPI constexpr Vector2 operator+(Vector2 a, Vector2 b);
+RMAPI constexpr Vector2 operator-(Vector2 a, Vector2 b);
+RMAPI constexpr Vector2 operator*(Vector2 a, Vector2 b);
+RMAPI constexpr Vector2 operator/(Vector2 a, Vector2 b);
 
-RMAPI Vector2 operator+(Vector2 a, float b);
-RMAPI Vector2 operator-(Vector2 a, float b);
-RMAPI Vector2 operator*(Vector2 a, float b);
-RMAPI Vector2 operator/(Vector2 a, float b);
+RMAPI constexpr Vector2 operator+(Vector2 a, float b);
+RMAPI constexpr Vector2 operator-(Vector2 a, float b);
+RMAPI constexpr Vector2 operator*(Vector2 a, float b);
+RMAPI constexpr Vector2 operator/(Vector2 a, float b);
 
 struct Vector3 {
     float x;
     float y;
     float z;
 
-    RMAPI Vector3 operator+=(Vector3 v);
-    RMAPI Vector3 operator-=(Vector3 v);
-    RMAPI Vector3 operator*=(Vector3 v);
-    RMAPI Vector3 operator/=(Vector3 v);
+    RMAPI constexpr Vector3 operator+=(Vector3 v);
+    RMAPI constexpr Vector3 operator-=(Vector3 v);
+    RMAPI constexpr Vector3 operator*=(Vector3 v);
+    RMAPI constexpr Vector3 operator/=(Vector3 v);
 
-    RMAPI Vector3 operator+=(float f);
-    RMAPI Vector3 operator-=(float f);
-    RMAPI Vector3 operator*=(float f);
-    RMAPI Vector3 operator/=(float f);
+    RMAPI constexpr Vector3 operator+=(float f);
+    RMAPI constexpr Vector3 operator-=(float f);
+    RMAPI constexpr Vector3 operator*=(float f);
+    RMAPI constexpr Vector3 operator/=(float f);
 
-    RMAPI operator Vector2() const;
-    RMAPI operator Vector4() const;
+    RMAPI constexpr operator Vector2() const;
+    RMAPI constexpr operator Vector4() const;
 };
 
-RMAPI Vector3 operator+(Vector3 a, Vector3 b);
-RMAPI Vector3 operator-(Vector3 a, Vector3 b);
-RMAPI Vector3 operator*(Vector3 a, Vector3 b);
-RMAPI Vector3 operator/(Vector3 a, Vector3 b);
+RMAPI constexpr Vector3 operator+(Vector3 a, Vector3 b);
+RMAPI constexpr Vector3 operator-(Vector3 a, Vector3 b);
+RMAPI constexpr Vector3 operator*(Vector3 a, Vector3 b);
+RMAPI constexpr Vector3 operator/(Vector3 a, Vector3 b);
 
-RMAPI Vector3 operator+(Vector3 a, float b);
-RMAPI Vector3 operator-(Vector3 a, float b);
-RMAPI Vector3 operator*(Vector3 a, float b);
-RMAPI Vector3 operator/(Vector3 a, float b);
+RMAPI constexpr Vector3 operator+(Vector3 a, float b);
+RMAPI constexpr Vector3 operator-(Vector3 a, float b);
+RMAPI constexpr Vector3 operator*(Vector3 a, float b);
+RMAPI constexpr Vector3 operator/(Vector3 a, float b);
 
 struct Vector4 {
     float x;
@@ -105,28 +134,28 @@ struct Vector4 {
     float z;
     float w;
 
-    RMAPI Vector4 operator+=(Vector4 v);
-    RMAPI Vector4 operator-=(Vector4 v);
-    RMAPI Vector4 operator*=(Vector4 v);
-    RMAPI Vector4 operator/=(Vector4 v);
+    RMAPI constexpr Vector4 operator+=(Vector4 v);
+    RMAPI constexpr Vector4 operator-=(Vector4 v);
+    RMAPI constexpr Vector4 operator*=(Vector4 v);
+    RMAPI constexpr Vector4 operator/=(Vector4 v);
 
-    RMAPI Vector4 operator+=(float f);
-    RMAPI Vector4 operator-=(float f);
-    RMAPI Vector4 operator*=(float f);
-    RMAPI Vector4 operator/=(float f);
+    RMAPI constexpr Vector4 operator+=(float f);
+    RMAPI constexpr Vector4 operator-=(float f);
+    RMAPI constexpr Vector4 operator*=(float f);
+    RMAPI constexpr Vector4 operator/=(float f);
 
-    RMAPI operator Vector3() const;
+    RMAPI constexpr operator Vector3() const;
 };
 
-RMAPI Vector4 operator+(Vector4 a, Vector4 b);
-RMAPI Vector4 operator-(Vector4 a, Vector4 b);
-RMAPI Vector4 operator*(Vector4 a, Vector4 b);
-RMAPI Vector4 operator/(Vector4 a, Vector4 b);
+RMAPI constexpr Vector4 operator+(Vector4 a, Vector4 b);
+RMAPI constexpr Vector4 operator-(Vector4 a, Vector4 b);
+RMAPI constexpr Vector4 operator*(Vector4 a, Vector4 b);
+RMAPI constexpr Vector4 operator/(Vector4 a, Vector4 b);
 
-RMAPI Vector4 operator+(Vector4 a, float b);
-RMAPI Vector4 operator-(Vector4 a, float b);
-RMAPI Vector4 operator*(Vector4 a, float b);
-RMAPI Vector4 operator/(Vector4 a, float b);
+RMAPI constexpr Vector4 operator+(Vector4 a, float b);
+RMAPI constexpr Vector4 operator-(Vector4 a, float b);
+RMAPI constexpr Vector4 operator*(Vector4 a, float b);
+RMAPI constexpr Vector4 operator/(Vector4 a, float b);
 
 typedef Vector4 Quaternion;
 
@@ -140,15 +169,48 @@ typedef struct Matrix {
     float m3, m7, m11, m15;     // Matrix fourth row (4 components)
 } Matrix;
 
-RMAPI Matrix operator+(Matrix a, Matrix b);
-RMAPI Matrix operator-(Matrix a, Matrix b);
-RMAPI Matrix operator*(Matrix a, Matrix b);
+// The SIMD paths load each row as 4 consecutive floats
+static_assert(sizeof(Matrix) == 16 * sizeof(float), "Matrix must be tightly packed");
+
+// Affine transform (rotation, scale, translation): a Matrix whose fourth row is always [0, 0, 0, 1].
+// Same field layout as the first 12 floats of Matrix, so ToAffine/ToMatrix are plain copies.
+// Compose, invert and derive normal matrices as Affine; promote with ToMatrix only at the GPU boundary.
+typedef struct Affine {
+    float m0, m4, m8, m12;      // Affine first row (4 components)
+    float m1, m5, m9, m13;      // Affine second row (4 components)
+    float m2, m6, m10, m14;     // Affine third row (4 components)
+} Affine;
+
+static_assert(sizeof(Affine) == 12 * sizeof(float), "Affine must be tightly packed");
+
+// Axis-aligned bounding box
+typedef struct BoundingBox {
+    Vector3 min;
+    Vector3 max;
+} BoundingBox;
+
+typedef struct BoundingSphere {
+    Vector3 center;
+    float radius;
+} BoundingSphere;
+
+// Planes as (a, b, c, d) with unit-length normals pointing inwards: a point is inside if a*x + b*y + c*z + d >= 0
+typedef struct ViewFrustum {
+    Vector4 planes[6];  // Left, right, bottom, top, near, far
+} ViewFrustum;
+
+RMAPI constexpr Matrix operator+(Matrix a, Matrix b);
+RMAPI constexpr Matrix operator-(Matrix a, Matrix b);
+RMAPI constexpr Matrix operator*(Matrix a, Matrix b);
 // No need for matrix division.
 
-RMAPI Vector4 operator*(Matrix m, Vector4 v);
-RMAPI Vector3 operator*(Matrix m, Vector3 v);
-RMAPI Vector2 operator*(Matrix m, Vector2 v);
-RMAPI Vector3 operator*(Quaternion a, Vector3 b);
+RMAPI constexpr Vector4 operator*(Matrix m, Vector4 v);
+RMAPI constexpr Vector3 operator*(Matrix m, Vector3 v);
+RMAPI constexpr Vector2 operator*(Matrix m, Vector2 v);
+RMAPI constexpr Vector3 operator*(Quaternion a, Vector3 b);
+
+RMAPI constexpr Affine operator*(Affine a, Affine b);
+RMAPI constexpr Vector3 operator*(Affine m, Vector3 v);
 
 constexpr Vector2 V2_RIGHT = { 1.0f, 0.0f };
 constexpr Vector2 V2_UP = { 0.0f, 1.0f };
@@ -176,7 +238,7 @@ constexpr Vector4 V4_IDENTITY = { 0.0f, 0.0f, 0.0f, 1.0f };
 // (I don't like the above macros because you can just do ToFloatN.v for float*)
 
 // Get Vector3 as float array
-RMAPI float3 ToFloat3(Vector3 v)
+RMAPI constexpr float3 ToFloat3(Vector3 v)
 {
     float3 buffer = { 0 };
 
@@ -187,7 +249,7 @@ RMAPI float3 ToFloat3(Vector3 v)
     return buffer;
 }
 
-RMAPI float9 ToFloat9(Matrix mat)
+RMAPI constexpr float9 ToFloat9(Matrix mat)
 {
     float9 result = { 0 };
 
@@ -208,7 +270,7 @@ RMAPI float9 ToFloat9(Matrix mat)
 
 // Get float array of matrix data (transposes the matrix from row-major to column-major)!
 // col0 = v[0-3], col1 = v[4-7], col2 = v[8-11], col3 = v[12-15]. Inspect in debugger!!!!
-RMAPI float16 ToFloat16(Matrix mat)
+RMAPI constexpr float16 ToFloat16(Matrix mat)
 {
     float16 result = { 0 };
 
@@ -243,7 +305,7 @@ RMAPI float Random(float min, float max)
 }
 
 // Clamp float value
-RMAPI float Clamp(float value, float min, float max)
+RMAPI constexpr float Clamp(float value, float min, float max)
 {
     float result = (value < min) ? min : value;
 
@@ -253,7 +315,7 @@ RMAPI float Clamp(float value, float min, float max)
 }
 
 // Calculate linear interpolation between two floats
-RMAPI float Lerp(float start, float end, float amount)
+RMAPI constexpr float Lerp(float start, float end, float amount)
 {
     float result = start + amount * (end - start);
 
@@ -261,13 +323,13 @@ RMAPI float Lerp(float start, float end, float amount)
 }
 
 // 1d tri-linear interpolation
-RMAPI float Terp(float A, float B, float C, Vector3 t)
+RMAPI constexpr float Terp(float A, float B, float C, Vector3 t)
 {
     return A * t.x + B * t.y + C * t.z;
 }
 
 // Normalize input value within input range
-RMAPI float Normalize(float value, float start, float end)
+RMAPI constexpr float Normalize(float value, float start, float end)
 {
     float result = (value - start) / (end - start);
 
@@ -275,7 +337,7 @@ RMAPI float Normalize(float value, float start, float end)
 }
 
 // Remap input value within input range to output range
-RMAPI float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
+RMAPI constexpr float Remap(float value, float inputStart, float inputEnd, float outputStart, float outputEnd)
 {
     float result = (value - inputStart) / (inputEnd - inputStart) * (outputEnd - outputStart) + outputStart;
 
@@ -303,7 +365,7 @@ RMAPI int Equals(float x, float y)
 //----------------------------------------------------------------------------------
 
 // Add two vectors (v1 + v2)
-RMAPI Vector2 Add(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Add(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x + v2.x, v1.y + v2.y };
 
@@ -311,7 +373,7 @@ RMAPI Vector2 Add(Vector2 v1, Vector2 v2)
 }
 
 // Add vector and float value
-RMAPI Vector2 Add(Vector2 v, float add)
+RMAPI constexpr Vector2 Add(Vector2 v, float add)
 {
     Vector2 result = { v.x + add, v.y + add };
 
@@ -319,7 +381,7 @@ RMAPI Vector2 Add(Vector2 v, float add)
 }
 
 // Subtract two vectors (v1 - v2)
-RMAPI Vector2 Subtract(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Subtract(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x - v2.x, v1.y - v2.y };
 
@@ -327,7 +389,7 @@ RMAPI Vector2 Subtract(Vector2 v1, Vector2 v2)
 }
 
 // Subtract vector by float value
-RMAPI Vector2 Subtract(Vector2 v, float sub)
+RMAPI constexpr Vector2 Subtract(Vector2 v, float sub)
 {
     Vector2 result = { v.x - sub, v.y - sub };
 
@@ -342,7 +404,7 @@ RMAPI float Length(Vector2 v)
 }
 
 // Calculate vector square length
-RMAPI float LengthSqr(Vector2 v)
+RMAPI constexpr float LengthSqr(Vector2 v)
 {
     float result = (v.x * v.x) + (v.y * v.y);
 
@@ -350,14 +412,14 @@ RMAPI float LengthSqr(Vector2 v)
 }
 
 // Calculate two vectors dot product
-RMAPI float Dot(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Dot(Vector2 v1, Vector2 v2)
 {
     float result = (v1.x * v2.x + v1.y * v2.y);
 
     return result;
 }
 
-RMAPI float Cross(Vector2 v1, Vector2 v2)
+RMAPI constexpr float Cross(Vector2 v1, Vector2 v2)
 {
     float result = v1.x * v2.y - v1.y * v2.x;
 
@@ -373,7 +435,7 @@ RMAPI float Distance(Vector2 v1, Vector2 v2)
 }
 
 // Calculate square distance between two vectors
-RMAPI float DistanceSqr(Vector2 v1, Vector2 v2)
+RMAPI constexpr float DistanceSqr(Vector2 v1, Vector2 v2)
 {
     float result = ((v1.x - v2.x) * (v1.x - v2.x) + (v1.y - v2.y) * (v1.y - v2.y));
 
@@ -381,7 +443,7 @@ RMAPI float DistanceSqr(Vector2 v1, Vector2 v2)
 }
 
 // -1 if below zero, +1 if above zero
-RMAPI float Sign(float value)
+RMAPI constexpr float Sign(float value)
 {
     float result = (value < 0.0f) ? -1.0f : 1.0f;
 
@@ -428,7 +490,7 @@ RMAPI float SignedAngle(Vector2 from, Vector2 to)
 }
 
 // Scale vector (multiply by value)
-RMAPI Vector2 Scale(Vector2 v, float scale)
+RMAPI constexpr Vector2 Scale(Vector2 v, float scale)
 {
     Vector2 result = { v.x * scale, v.y * scale };
 
@@ -436,14 +498,14 @@ RMAPI Vector2 Scale(Vector2 v, float scale)
 }
 
 // Project v1 onto v2
-RMAPI Vector2 Project(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Project(Vector2 v1, Vector2 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return { t * v2.x, t * v2.y };
 }
 
 // Scalar projection of v1 onto v2
-RMAPI float ProjectScalar(Vector2 v1, Vector2 v2)
+RMAPI constexpr float ProjectScalar(Vector2 v1, Vector2 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return t;
@@ -458,7 +520,7 @@ RMAPI Vector2 ProjectPointLine(Vector2 A, Vector2 B, Vector2 P)
 }
 
 // Multiply vector by vector
-RMAPI Vector2 Multiply(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Multiply(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x * v2.x, v1.y * v2.y };
 
@@ -466,7 +528,7 @@ RMAPI Vector2 Multiply(Vector2 v1, Vector2 v2)
 }
 
 // Negate vector
-RMAPI Vector2 Negate(Vector2 v)
+RMAPI constexpr Vector2 Negate(Vector2 v)
 {
     Vector2 result = { -v.x, -v.y };
 
@@ -474,7 +536,7 @@ RMAPI Vector2 Negate(Vector2 v)
 }
 
 // Divide vector by vector
-RMAPI Vector2 Divide(Vector2 v1, Vector2 v2)
+RMAPI constexpr Vector2 Divide(Vector2 v1, Vector2 v2)
 {
     Vector2 result = { v1.x / v2.x, v1.y / v2.y };
 
@@ -498,7 +560,7 @@ RMAPI Vector2 Normalize(Vector2 v)
 }
 
 // Transforms a Vector2 by a given Matrix
-RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
+RMAPI constexpr Vector2 Multiply(Vector2 v, Matrix mat)
 {
     Vector2 result = { 0 };
 
@@ -513,7 +575,7 @@ RMAPI Vector2 Multiply(Vector2 v, Matrix mat)
 }
 
 // Calculate linear interpolation between two vectors
-RMAPI Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
+RMAPI constexpr Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
 {
     Vector2 result = { 0 };
 
@@ -524,13 +586,13 @@ RMAPI Vector2 Lerp(Vector2 v1, Vector2 v2, float amount)
 }
 
 // 2d tri-linear interpolation
-RMAPI Vector2 Terp(Vector2 A, Vector2 B, Vector2 C, Vector3 t)
+RMAPI constexpr Vector2 Terp(Vector2 A, Vector2 B, Vector2 C, Vector3 t)
 {
     return A * t.x + B * t.y + C * t.z;
 }
 
 // Calculate reflected vector to normal
-RMAPI Vector2 Reflect(Vector2 v, Vector2 normal)
+RMAPI constexpr Vector2 Reflect(Vector2 v, Vector2 normal)
 {
     Vector2 result = { 0 };
 
@@ -583,7 +645,7 @@ RMAPI Vector2 RotateTowards(Vector2 from, Vector2 to, float maxRadians)
 }
 
 // Invert the given vector
-RMAPI Vector2 Invert(Vector2 v)
+RMAPI constexpr Vector2 Invert(Vector2 v)
 {
     Vector2 result = { 1.0f / v.x, 1.0f / v.y };
 
@@ -643,7 +705,7 @@ RMAPI bool Equals(Vector2 p, Vector2 q)
 //----------------------------------------------------------------------------------
 
 // Add two vectors
-RMAPI Vector3 Add(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Add(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x + v2.x, v1.y + v2.y, v1.z + v2.z };
 
@@ -651,7 +713,7 @@ RMAPI Vector3 Add(Vector3 v1, Vector3 v2)
 }
 
 // Add vector and float value
-RMAPI Vector3 Add(Vector3 v, float add)
+RMAPI constexpr Vector3 Add(Vector3 v, float add)
 {
     Vector3 result = { v.x + add, v.y + add, v.z + add };
 
@@ -659,7 +721,7 @@ RMAPI Vector3 Add(Vector3 v, float add)
 }
 
 // Subtract two vectors
-RMAPI Vector3 Subtract(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Subtract(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x - v2.x, v1.y - v2.y, v1.z - v2.z };
 
@@ -667,7 +729,7 @@ RMAPI Vector3 Subtract(Vector3 v1, Vector3 v2)
 }
 
 // Subtract vector by float value
-RMAPI Vector3 Subtract(Vector3 v, float sub)
+RMAPI constexpr Vector3 Subtract(Vector3 v, float sub)
 {
     Vector3 result = { v.x - sub, v.y - sub, v.z - sub };
 
@@ -675,7 +737,7 @@ RMAPI Vector3 Subtract(Vector3 v, float sub)
 }
 
 // Multiply vector by scalar
-RMAPI Vector3 Scale(Vector3 v, float scalar)
+RMAPI constexpr Vector3 Scale(Vector3 v, float scalar)
 {
     Vector3 result = { v.x * scalar, v.y * scalar, v.z * scalar };
 
@@ -683,7 +745,7 @@ RMAPI Vector3 Scale(Vector3 v, float scalar)
 }
 
 // Multiply vector by vector
-RMAPI Vector3 Multiply(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Multiply(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x * v2.x, v1.y * v2.y, v1.z * v2.z };
 
@@ -691,7 +753,7 @@ RMAPI Vector3 Multiply(Vector3 v1, Vector3 v2)
 }
 
 // Calculate two vectors cross product
-RMAPI Vector3 Cross(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Cross(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.y * v2.z - v1.z * v2.y, v1.z * v2.x - v1.x * v2.z, v1.x * v2.y - v1.y * v2.x };
 
@@ -736,7 +798,7 @@ RMAPI float Length(const Vector3 v)
 }
 
 // Calculate vector square length
-RMAPI float LengthSqr(const Vector3 v)
+RMAPI constexpr float LengthSqr(const Vector3 v)
 {
     float result = v.x * v.x + v.y * v.y + v.z * v.z;
 
@@ -744,7 +806,7 @@ RMAPI float LengthSqr(const Vector3 v)
 }
 
 // Calculate two vectors dot product
-RMAPI float Dot(Vector3 v1, Vector3 v2)
+RMAPI constexpr float Dot(Vector3 v1, Vector3 v2)
 {
     float result = (v1.x * v2.x + v1.y * v2.y + v1.z * v2.z);
 
@@ -765,7 +827,7 @@ RMAPI float Distance(Vector3 v1, Vector3 v2)
 }
 
 // Calculate square distance between two vectors
-RMAPI float DistanceSqr(Vector3 v1, Vector3 v2)
+RMAPI constexpr float DistanceSqr(Vector3 v1, Vector3 v2)
 {
     float result = 0.0f;
 
@@ -778,14 +840,14 @@ RMAPI float DistanceSqr(Vector3 v1, Vector3 v2)
 }
 
 // Project v1 onto v2
-RMAPI Vector3 Project(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Project(Vector3 v1, Vector3 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return { t * v2.x, t * v2.y, t * v2.z };
 }
 
 // Scalar projection of v1 onto v2
-RMAPI float ProjectScalar(Vector3 v1, Vector3 v2)
+RMAPI constexpr float ProjectScalar(Vector3 v1, Vector3 v2)
 {
     float t = Dot(v1, v2) / Dot(v2, v2);
     return t;
@@ -813,7 +875,7 @@ RMAPI float Angle(Vector3 v1, Vector3 v2)
 }
 
 // Negate provided vector (invert direction)
-RMAPI Vector3 Negate(Vector3 v)
+RMAPI constexpr Vector3 Negate(Vector3 v)
 {
     Vector3 result = { -v.x, -v.y, -v.z };
 
@@ -821,7 +883,7 @@ RMAPI Vector3 Negate(Vector3 v)
 }
 
 // Divide vector by vector
-RMAPI Vector3 Divide(Vector3 v1, Vector3 v2)
+RMAPI constexpr Vector3 Divide(Vector3 v1, Vector3 v2)
 {
     Vector3 result = { v1.x / v2.x, v1.y / v2.y, v1.z / v2.z };
 
@@ -880,7 +942,7 @@ RMAPI void OrthoNormalize(Vector3* v1, Vector3* v2)
 }
 
 // Transforms a Vector3 by a given Matrix
-RMAPI Vector3 Multiply(Vector3 v, Matrix mat)
+RMAPI constexpr Vector3 Multiply(Vector3 v, Matrix mat)
 {
     Vector3 result = { 0 };
 
@@ -896,7 +958,7 @@ RMAPI Vector3 Multiply(Vector3 v, Matrix mat)
 }
 
 // Transform a vector by quaternion rotation
-RMAPI Vector3 Rotate(Vector3 v, Quaternion q)
+RMAPI constexpr Vector3 Rotate(Vector3 v, Quaternion q)
 {
     Vector3 result = { 0 };
 
@@ -960,7 +1022,7 @@ RMAPI Vector3 Rotate(Vector3 v, Vector3 axis, float angle)
 }
 
 // Calculate linear interpolation between two vectors
-RMAPI Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
+RMAPI constexpr Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
 {
     Vector3 result = { 0 };
 
@@ -972,13 +1034,13 @@ RMAPI Vector3 Lerp(Vector3 v1, Vector3 v2, float amount)
 }
 
 // 3d tri-linear interpolation
-RMAPI Vector3 Terp(Vector3 A, Vector3 B, Vector3 C, Vector3 t)
+RMAPI constexpr Vector3 Terp(Vector3 A, Vector3 B, Vector3 C, Vector3 t)
 {
     return A * t.x + B * t.y + C * t.z;
 }
 
 // Calculate reflected vector to normal
-RMAPI Vector3 Reflect(Vector3 v, Vector3 normal)
+RMAPI constexpr Vector3 Reflect(Vector3 v, Vector3 normal)
 {
     Vector3 result = { 0 };
 
@@ -1021,7 +1083,7 @@ RMAPI Vector3 Max(Vector3 v1, Vector3 v2)
 
 // Compute barycenter coordinates (u, v, w) for point p with respect to triangle (a, b, c)
 // NOTE: Assumes P is on the plane of the triangle
-RMAPI Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
+RMAPI constexpr Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
 {
     Vector3 result = { 0 };
 
@@ -1045,7 +1107,7 @@ RMAPI Vector3 Barycenter(Vector3 p, Vector3 a, Vector3 b, Vector3 c)
 
 // Projects a Vector3 from screen space into object space
 // NOTE: We are avoiding calling other raymath functions despite available
-RMAPI Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
+RMAPI constexpr Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
 {
     Vector3 result = { 0 };
 
@@ -1128,7 +1190,7 @@ RMAPI Vector3 Unproject(Vector3 source, Matrix projection, Matrix view)
 }
 
 // Invert the given vector
-RMAPI Vector3 Invert(Vector3 v)
+RMAPI constexpr Vector3 Invert(Vector3 v)
 {
     Vector3 result = { 1.0f / v.x, 1.0f / v.y, 1.0f / v.z };
 
@@ -1218,7 +1280,7 @@ RMAPI Vector3 Refract(Vector3 v, Vector3 n, float r)
 //----------------------------------------------------------------------------------
 
 // Compute matrix determinant
-RMAPI float Determinant(Matrix mat)
+RMAPI constexpr float Determinant(Matrix mat)
 {
     float result = 0.0f;
 
@@ -1239,7 +1301,7 @@ RMAPI float Determinant(Matrix mat)
 }
 
 // Get the trace of the matrix (sum of the values along the diagonal)
-RMAPI float Trace(Matrix mat)
+RMAPI constexpr float Trace(Matrix mat)
 {
     float result = (mat.m0 + mat.m5 + mat.m10 + mat.m15);
 
@@ -1247,7 +1309,7 @@ RMAPI float Trace(Matrix mat)
 }
 
 // Transposes provided matrix
-RMAPI Matrix Transpose(Matrix mat)
+RMAPI constexpr Matrix Transpose(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1272,7 +1334,7 @@ RMAPI Matrix Transpose(Matrix mat)
 }
 
 // Invert provided matrix
-RMAPI Matrix Invert(Matrix mat)
+RMAPI constexpr Matrix InvertScalar(Matrix mat)
 {
     Matrix result = { 0 };
 
@@ -1318,8 +1380,92 @@ RMAPI Matrix Invert(Matrix mat)
     return result;
 }
 
+#ifdef MATH_SSE
+// 2x2 matrix helpers for Invert, each 2x2 matrix stored as (x y z w) = | x y |
+//                                                                        | z w |
+#define MATH_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+#define MATH_SWIZZLE(a, x, y, z, w) _mm_shuffle_ps(a, a, _MM_SHUFFLE(w, z, y, x))
+
+// A * B
+RMAPI __m128 Mat2Mul(__m128 a, __m128 b)
+{
+    return _mm_add_ps(_mm_mul_ps(a, MATH_SWIZZLE(b, 0, 3, 0, 3)), _mm_mul_ps(MATH_SWIZZLE(a, 1, 0, 3, 2), MATH_SWIZZLE(b, 2, 1, 2, 1)));
+}
+
+// adjugate(A) * B
+RMAPI __m128 Mat2AdjMul(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(MATH_SWIZZLE(a, 3, 3, 0, 0), b), _mm_mul_ps(MATH_SWIZZLE(a, 1, 1, 2, 2), MATH_SWIZZLE(b, 2, 3, 0, 1)));
+}
+
+// A * adjugate(B)
+RMAPI __m128 Mat2MulAdj(__m128 a, __m128 b)
+{
+    return _mm_sub_ps(_mm_mul_ps(a, MATH_SWIZZLE(b, 3, 0, 3, 0)), _mm_mul_ps(MATH_SWIZZLE(a, 1, 0, 3, 2), MATH_SWIZZLE(b, 2, 1, 2, 1)));
+}
+#endif
+
+// Invert provided matrix
+RMAPI constexpr Matrix Invert(Matrix mat)
+{
+#ifdef MATH_SSE
+    if (MATH_IS_CONSTANT_EVALUATED())
+        return InvertScalar(mat);
+
+    // Blockwise inversion of | A B |
+    //                        | C D | using 2x2 sub-matrices
+    __m128 r0 = _mm_loadu_ps(&mat.m0);
+    __m128 r1 = _mm_loadu_ps(&mat.m1);
+    __m128 r2 = _mm_loadu_ps(&mat.m2);
+    __m128 r3 = _mm_loadu_ps(&mat.m3);
+
+    __m128 A = _mm_movelh_ps(r0, r1);
+    __m128 B = _mm_movehl_ps(r1, r0);
+    __m128 C = _mm_movelh_ps(r2, r3);
+    __m128 D = _mm_movehl_ps(r3, r2);
+
+    // (|A| |B| |C| |D|)
+    __m128 detSub = _mm_sub_ps(
+        _mm_mul_ps(MATH_SHUFFLE(r0, r2, 0, 2, 0, 2), MATH_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+        _mm_mul_ps(MATH_SHUFFLE(r0, r2, 1, 3, 1, 3), MATH_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+    __m128 detA = MATH_SWIZZLE(detSub, 0, 0, 0, 0);
+    __m128 detB = MATH_SWIZZLE(detSub, 1, 1, 1, 1);
+    __m128 detC = MATH_SWIZZLE(detSub, 2, 2, 2, 2);
+    __m128 detD = MATH_SWIZZLE(detSub, 3, 3, 3, 3);
+
+    __m128 DC = Mat2AdjMul(D, C);
+    __m128 AB = Mat2AdjMul(A, B);
+    __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), Mat2Mul(B, DC));
+    __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), Mat2Mul(C, AB));
+    __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), Mat2MulAdj(D, AB));
+    __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), Mat2MulAdj(A, DC));
+
+    // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+    __m128 tr = _mm_mul_ps(AB, MATH_SWIZZLE(DC, 0, 2, 1, 3));
+    tr = _mm_add_ps(tr, MATH_SWIZZLE(tr, 2, 3, 0, 1));
+    tr = _mm_add_ps(tr, MATH_SWIZZLE(tr, 1, 0, 3, 2));
+    __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+
+    __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+    X = _mm_mul_ps(X, invDet);
+    Y = _mm_mul_ps(Y, invDet);
+    Z = _mm_mul_ps(Z, invDet);
+    W = _mm_mul_ps(W, invDet);
+
+    // Undo the adjugates while reassembling the rows
+    Matrix result = { 0 };
+    _mm_storeu_ps(&result.m0, MATH_SHUFFLE(X, Y, 3, 1, 3, 1));
+    _mm_storeu_ps(&result.m1, MATH_SHUFFLE(X, Y, 2, 0, 2, 0));
+    _mm_storeu_ps(&result.m2, MATH_SHUFFLE(Z, W, 3, 1, 3, 1));
+    _mm_storeu_ps(&result.m3, MATH_SHUFFLE(Z, W, 2, 0, 2, 0));
+    return result;
+#else
+    return InvertScalar(mat);
+#endif
+}
+
 // Get identity matrix
-RMAPI Matrix MatrixIdentity(void)
+RMAPI constexpr Matrix MatrixIdentity(void)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
@@ -1330,7 +1476,7 @@ RMAPI Matrix MatrixIdentity(void)
 }
 
 // Add two matrices
-RMAPI Matrix Add(Matrix left, Matrix right)
+RMAPI constexpr Matrix Add(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1355,7 +1501,7 @@ RMAPI Matrix Add(Matrix left, Matrix right)
 }
 
 // Subtract two matrices (left - right)
-RMAPI Matrix Subtract(Matrix left, Matrix right)
+RMAPI constexpr Matrix Subtract(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1381,7 +1527,7 @@ RMAPI Matrix Subtract(Matrix left, Matrix right)
 
 // Get two matrix multiplication
 // NOTE: When multiplying matrices... the order matters!
-RMAPI Matrix Multiply(Matrix left, Matrix right)
+RMAPI constexpr Matrix MultiplyScalar(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
@@ -1405,8 +1551,69 @@ RMAPI Matrix Multiply(Matrix left, Matrix right)
     return result;
 }
 
+#if defined(MATH_SSE)
+// w.x * l0 + w.y * l1 + w.z * l2 + w.w * l3
+RMAPI __m128 MultiplyRow(__m128 w, __m128 l0, __m128 l1, __m128 l2, __m128 l3)
+{
+    __m128 row = _mm_mul_ps(MATH_SWIZZLE(w, 0, 0, 0, 0), l0);
+    row = _mm_add_ps(row, _mm_mul_ps(MATH_SWIZZLE(w, 1, 1, 1, 1), l1));
+    row = _mm_add_ps(row, _mm_mul_ps(MATH_SWIZZLE(w, 2, 2, 2, 2), l2));
+    row = _mm_add_ps(row, _mm_mul_ps(MATH_SWIZZLE(w, 3, 3, 3, 3), l3));
+    return row;
+}
+#elif defined(MATH_NEON)
+// w.x * l0 + w.y * l1 + w.z * l2 + w.w * l3
+// Separate multiplies and adds (not vmlaq/vfmaq) so rounding matches the scalar version
+RMAPI float32x4_t MultiplyRow(float32x4_t w, float32x4_t l0, float32x4_t l1, float32x4_t l2, float32x4_t l3)
+{
+    float32x4_t row = vmulq_n_f32(l0, vgetq_lane_f32(w, 0));
+    row = vaddq_f32(row, vmulq_n_f32(l1, vgetq_lane_f32(w, 1)));
+    row = vaddq_f32(row, vmulq_n_f32(l2, vgetq_lane_f32(w, 2)));
+    row = vaddq_f32(row, vmulq_n_f32(l3, vgetq_lane_f32(w, 3)));
+    return row;
+}
+#endif
+
+// Get two matrix multiplication
+// NOTE: When multiplying matrices... the order matters!
+RMAPI constexpr Matrix Multiply(Matrix left, Matrix right)
+{
+    // Each result row is a combination of left's rows weighted by the matching row of right
+#if defined(MATH_SSE) || defined(MATH_NEON)
+    if (MATH_IS_CONSTANT_EVALUATED())
+        return MultiplyScalar(left, right);
+#endif
+#if defined(MATH_SSE)
+    __m128 l0 = _mm_loadu_ps(&left.m0);
+    __m128 l1 = _mm_loadu_ps(&left.m1);
+    __m128 l2 = _mm_loadu_ps(&left.m2);
+    __m128 l3 = _mm_loadu_ps(&left.m3);
+
+    Matrix result = { 0 };
+    _mm_storeu_ps(&result.m0, MultiplyRow(_mm_loadu_ps(&right.m0), l0, l1, l2, l3));
+    _mm_storeu_ps(&result.m1, MultiplyRow(_mm_loadu_ps(&right.m1), l0, l1, l2, l3));
+    _mm_storeu_ps(&result.m2, MultiplyRow(_mm_loadu_ps(&right.m2), l0, l1, l2, l3));
+    _mm_storeu_ps(&result.m3, MultiplyRow(_mm_loadu_ps(&right.m3), l0, l1, l2, l3));
+    return result;
+#elif defined(MATH_NEON)
+    float32x4_t l0 = vld1q_f32(&left.m0);
+    float32x4_t l1 = vld1q_f32(&left.m1);
+    float32x4_t l2 = vld1q_f32(&left.m2);
+    float32x4_t l3 = vld1q_f32(&left.m3);
+
+    Matrix result = { 0 };
+    vst1q_f32(&result.m0, MultiplyRow(vld1q_f32(&right.m0), l0, l1, l2, l3));
+    vst1q_f32(&result.m1, MultiplyRow(vld1q_f32(&right.m1), l0, l1, l2, l3));
+    vst1q_f32(&result.m2, MultiplyRow(vld1q_f32(&right.m2), l0, l1, l2, l3));
+    vst1q_f32(&result.m3, MultiplyRow(vld1q_f32(&right.m3), l0, l1, l2, l3));
+    return result;
+#else
+    return MultiplyScalar(left, right);
+#endif
+}
+
 // Get translation matrix
-RMAPI Matrix Translate(float x, float y, float z)
+RMAPI constexpr Matrix Translate(float x, float y, float z)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, x,
                       0.0f, 1.0f, 0.0f, y,
@@ -1590,7 +1797,7 @@ RMAPI Matrix RotateZYX(Vector3 angle)
 }
 
 // Get scaling matrix
-RMAPI Matrix Scale(float x, float y, float z)
+RMAPI constexpr Matrix Scale(float x, float y, float z)
 {
     Matrix result = { x, 0.0f, 0.0f, 0.0f,
                       0.0f, y, 0.0f, 0.0f,
@@ -1601,7 +1808,7 @@ RMAPI Matrix Scale(float x, float y, float z)
 }
 
 // Get perspective projection matrix
-RMAPI Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
+RMAPI constexpr Matrix Frustum(double left, double right, double bottom, double top, double near, double far)
 {
     Matrix result = { 0 };
 
@@ -1660,7 +1867,7 @@ RMAPI Matrix Perspective(double fovy, double aspect, double near, double far)
 }
 
 // Get orthographic projection matrix
-RMAPI Matrix Ortho(double left, double right, double bottom, double top, double near, double far)
+RMAPI constexpr Matrix Ortho(double left, double right, double bottom, double top, double near, double far)
 {
     Matrix result = { 0 };
 
@@ -1767,12 +1974,405 @@ inline Vector3 Clip(Matrix m, Vector3 v)
     return { clip.x, clip.y, clip.z };
 }
 
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Affine math
+//----------------------------------------------------------------------------------
+
+// Drop the fourth row of an affine matrix (projections are not affine!)
+RMAPI constexpr Affine ToAffine(Matrix mat)
+{
+    Affine result = { 0 };
+
+    result.m0 = mat.m0; result.m4 = mat.m4; result.m8 = mat.m8; result.m12 = mat.m12;
+    result.m1 = mat.m1; result.m5 = mat.m5; result.m9 = mat.m9; result.m13 = mat.m13;
+    result.m2 = mat.m2; result.m6 = mat.m6; result.m10 = mat.m10; result.m14 = mat.m14;
+
+    return result;
+}
+
+// Promote to a full matrix (ie to combine with a projection or to upload as a mat4)
+RMAPI constexpr Matrix ToMatrix(Affine aff)
+{
+    Matrix result = { 0 };
+
+    result.m0 = aff.m0; result.m4 = aff.m4; result.m8 = aff.m8; result.m12 = aff.m12;
+    result.m1 = aff.m1; result.m5 = aff.m5; result.m9 = aff.m9; result.m13 = aff.m13;
+    result.m2 = aff.m2; result.m6 = aff.m6; result.m10 = aff.m10; result.m14 = aff.m14;
+    result.m15 = 1.0f;
+
+    return result;
+}
+
+RMAPI constexpr Vector3 Translation(Affine aff)
+{
+    return { aff.m12, aff.m13, aff.m14 };
+}
+
+RMAPI constexpr Affine AffineIdentity()
+{
+    Affine result = { 1.0f, 0.0f, 0.0f, 0.0f,
+                      0.0f, 1.0f, 0.0f, 0.0f,
+                      0.0f, 0.0f, 1.0f, 0.0f };
+
+    return result;
+}
+
+// Affine versions of Translate, Scale and RotateX/Y/Z, so world matrices never have to be built as a full Matrix
+RMAPI constexpr Affine AffineTranslate(float x, float y, float z)
+{
+    Affine result = { 1.0f, 0.0f, 0.0f, x,
+                      0.0f, 1.0f, 0.0f, y,
+                      0.0f, 0.0f, 1.0f, z };
+
+    return result;
+}
+
+RMAPI constexpr Affine AffineTranslate(Vector3 v)
+{
+    return AffineTranslate(v.x, v.y, v.z);
+}
+
+RMAPI constexpr Affine AffineScale(float x, float y, float z)
+{
+    Affine result = { x, 0.0f, 0.0f, 0.0f,
+                      0.0f, y, 0.0f, 0.0f,
+                      0.0f, 0.0f, z, 0.0f };
+
+    return result;
+}
+
+RMAPI constexpr Affine AffineScale(Vector3 v)
+{
+    return AffineScale(v.x, v.y, v.z);
+}
+
+// NOTE: Angle must be provided in radians
+RMAPI Affine AffineRotateX(float angle)
+{
+    Affine result = AffineIdentity();
+
+    float cosres = cosf(angle);
+    float sinres = sinf(angle);
+
+    result.m5 = cosres;
+    result.m6 = sinres;
+    result.m9 = -sinres;
+    result.m10 = cosres;
+
+    return result;
+}
+
+// NOTE: Angle must be provided in radians
+RMAPI Affine AffineRotateY(float angle)
+{
+    Affine result = AffineIdentity();
+
+    float cosres = cosf(angle);
+    float sinres = sinf(angle);
+
+    result.m0 = cosres;
+    result.m2 = -sinres;
+    result.m8 = sinres;
+    result.m10 = cosres;
+
+    return result;
+}
+
+// NOTE: Angle must be provided in radians
+RMAPI Affine AffineRotateZ(float angle)
+{
+    Affine result = AffineIdentity();
+
+    float cosres = cosf(angle);
+    float sinres = sinf(angle);
+
+    result.m0 = cosres;
+    result.m1 = sinres;
+    result.m4 = -sinres;
+    result.m5 = cosres;
+
+    return result;
+}
+
+// Same convention as Multiply(Matrix, Matrix) (left is applied first).
+// Matches it exactly (up to the sign of zero) since the dropped terms are products with 0 and 1.
+// 36 multiplies instead of 64
+RMAPI constexpr Affine MultiplyScalar(Affine left, Affine right)
+{
+    Affine result = { 0 };
+
+    result.m0 = left.m0 * right.m0 + left.m1 * right.m4 + left.m2 * right.m8;
+    result.m1 = left.m0 * right.m1 + left.m1 * right.m5 + left.m2 * right.m9;
+    result.m2 = left.m0 * right.m2 + left.m1 * right.m6 + left.m2 * right.m10;
+    result.m4 = left.m4 * right.m0 + left.m5 * right.m4 + left.m6 * right.m8;
+    result.m5 = left.m4 * right.m1 + left.m5 * right.m5 + left.m6 * right.m9;
+    result.m6 = left.m4 * right.m2 + left.m5 * right.m6 + left.m6 * right.m10;
+    result.m8 = left.m8 * right.m0 + left.m9 * right.m4 + left.m10 * right.m8;
+    result.m9 = left.m8 * right.m1 + left.m9 * right.m5 + left.m10 * right.m9;
+    result.m10 = left.m8 * right.m2 + left.m9 * right.m6 + left.m10 * right.m10;
+    result.m12 = left.m12 * right.m0 + left.m13 * right.m4 + left.m14 * right.m8 + right.m12;
+    result.m13 = left.m12 * right.m1 + left.m13 * right.m5 + left.m14 * right.m9 + right.m13;
+    result.m14 = left.m12 * right.m2 + left.m13 * right.m6 + left.m14 * right.m10 + right.m14;
+
+    return result;
+}
+
+// 3 rows instead of 4. Left's implicit fourth row [0, 0, 0, 1] carries right's translation
+RMAPI constexpr Affine Multiply(Affine left, Affine right)
+{
+#if defined(MATH_SSE) || defined(MATH_NEON)
+    if (MATH_IS_CONSTANT_EVALUATED())
+        return MultiplyScalar(left, right);
+#endif
+#if defined(MATH_SSE)
+    __m128 l0 = _mm_loadu_ps(&left.m0);
+    __m128 l1 = _mm_loadu_ps(&left.m1);
+    __m128 l2 = _mm_loadu_ps(&left.m2);
+    __m128 l3 = _mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f);
+
+    Affine result = { 0 };
+    _mm_storeu_ps(&result.m0, MultiplyRow(_mm_loadu_ps(&right.m0), l0, l1, l2, l3));
+    _mm_storeu_ps(&result.m1, MultiplyRow(_mm_loadu_ps(&right.m1), l0, l1, l2, l3));
+    _mm_storeu_ps(&result.m2, MultiplyRow(_mm_loadu_ps(&right.m2), l0, l1, l2, l3));
+    return result;
+#elif defined(MATH_NEON)
+    float32x4_t l0 = vld1q_f32(&left.m0);
+    float32x4_t l1 = vld1q_f32(&left.m1);
+    float32x4_t l2 = vld1q_f32(&left.m2);
+    float32x4_t l3 = vsetq_lane_f32(1.0f, vdupq_n_f32(0.0f), 3);
+
+    Affine result = { 0 };
+    vst1q_f32(&result.m0, MultiplyRow(vld1q_f32(&right.m0), l0, l1, l2, l3));
+    vst1q_f32(&result.m1, MultiplyRow(vld1q_f32(&right.m1), l0, l1, l2, l3));
+    vst1q_f32(&result.m2, MultiplyRow(vld1q_f32(&right.m2), l0, l1, l2, l3));
+    return result;
+#else
+    return MultiplyScalar(left, right);
+#endif
+}
+
+// Transform a point (same as Multiply(Vector3, Matrix))
+RMAPI constexpr Vector3 Multiply(Vector3 v, Affine aff)
+{
+    Vector3 result = { 0 };
+
+    float x = v.x;
+    float y = v.y;
+    float z = v.z;
+
+    result.x = aff.m0 * x + aff.m4 * y + aff.m8 * z + aff.m12;
+    result.y = aff.m1 * x + aff.m5 * y + aff.m9 * z + aff.m13;
+    result.z = aff.m2 * x + aff.m6 * y + aff.m10 * z + aff.m14;
+
+    return result;
+}
+
+RMAPI constexpr float Determinant(Affine aff)
+{
+    return aff.m0 * (aff.m5 * aff.m10 - aff.m9 * aff.m6) +
+           aff.m4 * (aff.m9 * aff.m2 - aff.m1 * aff.m10) +
+           aff.m8 * (aff.m1 * aff.m6 - aff.m5 * aff.m2);
+}
+
+// Inverse of any affine transform (handles scale and shear): 3x3 adjugate / determinant, then translation = -inverse * t.
+// About a third of the work of Invert(Matrix)
+RMAPI constexpr Affine Invert(Affine aff)
+{
+    Affine result = { 0 };
+
+    // Cofactors of the 3x3 part (cRC = row R, column C)
+    float c00 = aff.m5 * aff.m10 - aff.m9 * aff.m6;
+    float c01 = aff.m9 * aff.m2 - aff.m1 * aff.m10;
+    float c02 = aff.m1 * aff.m6 - aff.m5 * aff.m2;
+    float c10 = aff.m8 * aff.m6 - aff.m4 * aff.m10;
+    float c11 = aff.m0 * aff.m10 - aff.m8 * aff.m2;
+    float c12 = aff.m4 * aff.m2 - aff.m0 * aff.m6;
+    float c20 = aff.m4 * aff.m9 - aff.m8 * aff.m5;
+    float c21 = aff.m8 * aff.m1 - aff.m0 * aff.m9;
+    float c22 = aff.m0 * aff.m5 - aff.m4 * aff.m1;
+
+    float invDet = 1.0f / (aff.m0 * c00 + aff.m4 * c01 + aff.m8 * c02);
+
+    // Inverse = transposed cofactors / determinant
+    result.m0 = c00 * invDet; result.m4 = c10 * invDet; result.m8 = c20 * invDet;
+    result.m1 = c01 * invDet; result.m5 = c11 * invDet; result.m9 = c21 * invDet;
+    result.m2 = c02 * invDet; result.m6 = c12 * invDet; result.m10 = c22 * invDet;
+
+    result.m12 = -(result.m0 * aff.m12 + result.m4 * aff.m13 + result.m8 * aff.m14);
+    result.m13 = -(result.m1 * aff.m12 + result.m5 * aff.m13 + result.m9 * aff.m14);
+    result.m14 = -(result.m2 * aff.m12 + result.m6 * aff.m13 + result.m10 * aff.m14);
+
+    return result;
+}
+
+// Inverse of a rotation + translation (no scale!): transposed rotation, translation = -transposed rotation * t.
+// Use for cameras and other rigid transforms; use Invert if there's any scale
+RMAPI constexpr Affine InvertRigid(Affine aff)
+{
+    Affine result = { 0 };
+
+    result.m0 = aff.m0; result.m4 = aff.m1; result.m8 = aff.m2;
+    result.m1 = aff.m4; result.m5 = aff.m5; result.m9 = aff.m6;
+    result.m2 = aff.m8; result.m6 = aff.m9; result.m10 = aff.m10;
+
+    result.m12 = -(result.m0 * aff.m12 + result.m4 * aff.m13 + result.m8 * aff.m14);
+    result.m13 = -(result.m1 * aff.m12 + result.m5 * aff.m13 + result.m9 * aff.m14);
+    result.m14 = -(result.m2 * aff.m12 + result.m6 * aff.m13 + result.m10 * aff.m14);
+
+    return result;
+}
+
+// Inverse-transpose of the 3x3 part (cofactors / determinant), translation is zero.
+// Same as NormalMatrix(Matrix) without the general 4x4 inverse and transpose
+RMAPI constexpr Affine NormalMatrix(Affine world)
+{
+    Affine result = { 0 };
+
+    float c00 = world.m5 * world.m10 - world.m9 * world.m6;
+    float c01 = world.m9 * world.m2 - world.m1 * world.m10;
+    float c02 = world.m1 * world.m6 - world.m5 * world.m2;
+    float c10 = world.m8 * world.m6 - world.m4 * world.m10;
+    float c11 = world.m0 * world.m10 - world.m8 * world.m2;
+    float c12 = world.m4 * world.m2 - world.m0 * world.m6;
+    float c20 = world.m4 * world.m9 - world.m8 * world.m5;
+    float c21 = world.m8 * world.m1 - world.m0 * world.m9;
+    float c22 = world.m0 * world.m5 - world.m4 * world.m1;
+
+    float invDet = 1.0f / (world.m0 * c00 + world.m4 * c01 + world.m8 * c02);
+
+    result.m0 = c00 * invDet; result.m4 = c01 * invDet; result.m8 = c02 * invDet;
+    result.m1 = c10 * invDet; result.m5 = c11 * invDet; result.m9 = c12 * invDet;
+    result.m2 = c20 * invDet; result.m6 = c21 * invDet; result.m10 = c22 * invDet;
+
+    return result;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Bounding volumes and frustum culling
+//----------------------------------------------------------------------------------
+
+// Extract the clip planes of a view-projection matrix (Gribb & Hartmann), works for Perspective and Ortho.
+// Planes are in whatever space the matrix transforms from (world space for view * proj).
+RMAPI ViewFrustum ToViewFrustum(Matrix viewProj)
+{
+    ViewFrustum result = { 0 };
+
+    // Rows of the matrix; clip = (dot(r0, v), dot(r1, v), dot(r2, v), dot(r3, v)) and inside is -w <= x, y, z <= w
+    Vector4 r0 = { viewProj.m0, viewProj.m4, viewProj.m8, viewProj.m12 };
+    Vector4 r1 = { viewProj.m1, viewProj.m5, viewProj.m9, viewProj.m13 };
+    Vector4 r2 = { viewProj.m2, viewProj.m6, viewProj.m10, viewProj.m14 };
+    Vector4 r3 = { viewProj.m3, viewProj.m7, viewProj.m11, viewProj.m15 };
+
+    result.planes[0] = r3 + r0;
+    result.planes[1] = r3 - r0;
+    result.planes[2] = r3 + r1;
+    result.planes[3] = r3 - r1;
+    result.planes[4] = r3 + r2;
+    result.planes[5] = r3 - r2;
+
+    // Unit normals so plane distances are real distances (needed for sphere radii)
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = result.planes[i];
+        float length = sqrtf(plane.x * plane.x + plane.y * plane.y + plane.z * plane.z);
+        result.planes[i] = plane * (1.0f / length);
+    }
+
+    return result;
+}
+
+RMAPI BoundingBox ToBoundingBox(const Vector3* points, int count)
+{
+    BoundingBox result = { V3_ZERO, V3_ZERO };
+    if (count <= 0) return result;
+
+    result.min = result.max = points[0];
+    for (int i = 1; i < count; i++)
+    {
+        result.min = Min(result.min, points[i]);
+        result.max = Max(result.max, points[i]);
+    }
+
+    return result;
+}
+
+// Sphere around the box centre just big enough for every point (tighter than the box's half-diagonal)
+RMAPI BoundingSphere ToBoundingSphere(const Vector3* points, int count)
+{
+    BoundingBox box = ToBoundingBox(points, count);
+    BoundingSphere result = { (box.min + box.max) * 0.5f, 0.0f };
+
+    float radiusSqr = 0.0f;
+    for (int i = 0; i < count; i++)
+        radiusSqr = fmaxf(radiusSqr, DistanceSqr(result.center, points[i]));
+    result.radius = sqrtf(radiusSqr);
+
+    return result;
+}
+
+// Box around the transformed box (Arvo): centre is transformed, extents are summed along each world axis
+RMAPI BoundingBox Transform(BoundingBox box, Affine world)
+{
+    Vector3 center = (box.min + box.max) * 0.5f;
+    Vector3 extents = (box.max - box.min) * 0.5f;
+
+    Vector3 worldCenter = Multiply(center, world);
+    Vector3 worldExtents = {
+        fabsf(world.m0) * extents.x + fabsf(world.m4) * extents.y + fabsf(world.m8) * extents.z,
+        fabsf(world.m1) * extents.x + fabsf(world.m5) * extents.y + fabsf(world.m9) * extents.z,
+        fabsf(world.m2) * extents.x + fabsf(world.m6) * extents.y + fabsf(world.m10) * extents.z
+    };
+
+    BoundingBox result = { worldCenter - worldExtents, worldCenter + worldExtents };
+    return result;
+}
+
+// Radius grows by the largest axis scale, so non-uniform scale gives a conservative sphere
+RMAPI BoundingSphere Transform(BoundingSphere sphere, Affine world)
+{
+    float scaleX = world.m0 * world.m0 + world.m1 * world.m1 + world.m2 * world.m2;
+    float scaleY = world.m4 * world.m4 + world.m5 * world.m5 + world.m6 * world.m6;
+    float scaleZ = world.m8 * world.m8 + world.m9 * world.m9 + world.m10 * world.m10;
+
+    BoundingSphere result = { Multiply(sphere.center, world), sphere.radius * sqrtf(fmaxf(scaleX, fmaxf(scaleY, scaleZ))) };
+    return result;
+}
+
+// Conservative: may return true for volumes just outside a frustum corner, never false for visible ones
+RMAPI bool InFrustum(const ViewFrustum& frustum, BoundingSphere sphere)
+{
+    for (int i = 0; i < 6; i++)
+    {
+        Vector4 plane = frustum.planes[i];
+        float distance = plane.x * sphere.center.x + plane.y * sphere.center.y + plane.z * sphere.center.z + plane.w;
+        if (distance < -sphere.radius)
+            return false;
+    }
+    return true;
+}
+
+RMAPI bool InFrustum(const ViewFrustum& frustum, BoundingBox box)
+{
+    Vector3 center = (box.min + box.max) * 0.5f;
+    Vector3 extents = (box.max - box.min) * 0.5f;
+    for (int i = 0; i < 6; i++)
+    {
+        // Outside if even the corner furthest along the plane normal is behind the plane
+        Vector4 plane = frustum.planes[i];
+        float distance = plane.x * center.x + plane.y * center.y + plane.z * center.z + plane.w;
+        float radius = fabsf(plane.x) * extents.x + fabsf(plane.y) * extents.y + fabsf(plane.z) * extents.z;
+        if (distance < -radius)
+            return false;
+    }
+    return true;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Quaternion math
 //----------------------------------------------------------------------------------
 
 // Add two quaternions
-RMAPI Quaternion Add(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Add(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x + q2.x, q1.y + q2.y, q1.z + q2.z, q1.w + q2.w };
 
@@ -1780,7 +2380,7 @@ RMAPI Quaternion Add(Quaternion q1, Quaternion q2)
 }
 
 // Add quaternion and float value
-RMAPI Quaternion Add(Quaternion q, float add)
+RMAPI constexpr Quaternion Add(Quaternion q, float add)
 {
     Quaternion result = { q.x + add, q.y + add, q.z + add, q.w + add };
 
@@ -1788,7 +2388,7 @@ RMAPI Quaternion Add(Quaternion q, float add)
 }
 
 // Subtract two quaternions
-RMAPI Quaternion Subtract(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Subtract(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x - q2.x, q1.y - q2.y, q1.z - q2.z, q1.w - q2.w };
 
@@ -1796,7 +2396,7 @@ RMAPI Quaternion Subtract(Quaternion q1, Quaternion q2)
 }
 
 // Subtract quaternion and float value
-RMAPI Quaternion Subtract(Quaternion q, float sub)
+RMAPI constexpr Quaternion Subtract(Quaternion q, float sub)
 {
     Quaternion result = { q.x - sub, q.y - sub, q.z - sub, q.w - sub };
 
@@ -1804,7 +2404,7 @@ RMAPI Quaternion Subtract(Quaternion q, float sub)
 }
 
 // Get identity quaternion
-RMAPI Quaternion QuaternionIdentity(void)
+RMAPI constexpr Quaternion QuaternionIdentity(void)
 {
     Quaternion result = { 0.0f, 0.0f, 0.0f, 1.0f };
 
@@ -1837,7 +2437,7 @@ RMAPI Quaternion Normalize(Quaternion q)
 }
 
 // Invert provided quaternion
-RMAPI Quaternion Invert(Quaternion q)
+RMAPI constexpr Quaternion Invert(Quaternion q)
 {
     Quaternion result = q;
 
@@ -1857,7 +2457,7 @@ RMAPI Quaternion Invert(Quaternion q)
 }
 
 // Calculate two quaternion multiplication
-RMAPI Quaternion Multiply(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Multiply(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { 0 };
 
@@ -1873,7 +2473,7 @@ RMAPI Quaternion Multiply(Quaternion q1, Quaternion q2)
 }
 
 // Scale quaternion by float value
-RMAPI Quaternion Scale(Quaternion q, float mul)
+RMAPI constexpr Quaternion Scale(Quaternion q, float mul)
 {
     Quaternion result = { 0 };
 
@@ -1886,7 +2486,7 @@ RMAPI Quaternion Scale(Quaternion q, float mul)
 }
 
 // Divide two quaternions
-RMAPI Quaternion Divide(Quaternion q1, Quaternion q2)
+RMAPI constexpr Quaternion Divide(Quaternion q1, Quaternion q2)
 {
     Quaternion result = { q1.x / q2.x, q1.y / q2.y, q1.z / q2.z, q1.w / q2.w };
 
@@ -1894,7 +2494,7 @@ RMAPI Quaternion Divide(Quaternion q1, Quaternion q2)
 }
 
 // Calculate linear interpolation between two quaternions
-RMAPI Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
+RMAPI constexpr Quaternion Lerp(Quaternion q1, Quaternion q2, float amount)
 {
     Quaternion result = { 0 };
 
@@ -2066,7 +2666,7 @@ RMAPI Quaternion FromMatrix(Matrix mat)
 }
 
 // Get a matrix for a given quaternion
-RMAPI Matrix ToMatrix(Quaternion q)
+RMAPI constexpr Matrix ToMatrix(Quaternion q)
 {
     Matrix result = { 1.0f, 0.0f, 0.0f, 0.0f,
                       0.0f, 1.0f, 0.0f, 0.0f,
@@ -2228,7 +2828,7 @@ RMAPI Vector3 ToEuler(Quaternion q)
 }
 
 // Transform a quaternion given a transformation matrix
-RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
+RMAPI constexpr Quaternion MultiplyScalar(Quaternion q, Matrix mat)
 {
     Quaternion result = { 0 };
 
@@ -2240,6 +2840,45 @@ RMAPI Quaternion Multiply(Quaternion q, Matrix mat)
     return result;
 }
 
+// Transform a quaternion given a transformation matrix
+RMAPI constexpr Quaternion Multiply(Quaternion q, Matrix mat)
+{
+    // result = x * column0 + y * column1 + z * column2 + w * column3
+#if defined(MATH_SSE) || defined(MATH_NEON)
+    if (MATH_IS_CONSTANT_EVALUATED())
+        return MultiplyScalar(q, mat);
+#endif
+#if defined(MATH_SSE)
+    __m128 c0 = _mm_loadu_ps(&mat.m0);
+    __m128 c1 = _mm_loadu_ps(&mat.m1);
+    __m128 c2 = _mm_loadu_ps(&mat.m2);
+    __m128 c3 = _mm_loadu_ps(&mat.m3);
+    _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+    __m128 result = _mm_mul_ps(c0, _mm_set1_ps(q.x));
+    result = _mm_add_ps(result, _mm_mul_ps(c1, _mm_set1_ps(q.y)));
+    result = _mm_add_ps(result, _mm_mul_ps(c2, _mm_set1_ps(q.z)));
+    result = _mm_add_ps(result, _mm_mul_ps(c3, _mm_set1_ps(q.w)));
+
+    Quaternion out = { 0 };
+    _mm_storeu_ps(&out.x, result);
+    return out;
+#elif defined(MATH_NEON)
+    // De-interleaving load gives us the columns directly
+    float32x4x4_t c = vld4q_f32(&mat.m0);
+    float32x4_t result = vmulq_n_f32(c.val[0], q.x);
+    result = vaddq_f32(result, vmulq_n_f32(c.val[1], q.y));
+    result = vaddq_f32(result, vmulq_n_f32(c.val[2], q.z));
+    result = vaddq_f32(result, vmulq_n_f32(c.val[3], q.w));
+
+    Quaternion out = { 0 };
+    vst1q_f32(&out.x, result);
+    return out;
+#else
+    return MultiplyScalar(q, mat);
+#endif
+}
+
 // Check whether two given quaternions are almost equal
 RMAPI int Equals(Quaternion p, Quaternion q)
 {
@@ -2259,27 +2898,27 @@ RMAPI int Equals(Quaternion p, Quaternion q)
 // Module Functions Definition - Vector & Matrix helpers
 //----------------------------------------------------------------------------------
 
-RMAPI Vector3 Forward(Matrix m)
+RMAPI constexpr Vector3 Forward(Matrix m)
 {
     return { m.m8, m.m9, m.m10 };
 }
 
-RMAPI Vector3 Right(Matrix m)
+RMAPI constexpr Vector3 Right(Matrix m)
 {
     return { m.m0, m.m1, m.m2 };
 }
 
-RMAPI Vector3 Up(Matrix m)
+RMAPI constexpr Vector3 Up(Matrix m)
 {
     return { m.m4, m.m5, m.m6 };
 }
 
-RMAPI Vector3 Translation(Matrix m)
+RMAPI constexpr Vector3 Translation(Matrix m)
 {
     return { m.m12, m.m13, m.m14 };
 }
 
-RMAPI Matrix Translate(Vector3 v)
+RMAPI constexpr Matrix Translate(Vector3 v)
 {
     return Translate(v.x, v.y, v.z);
 }
@@ -2289,7 +2928,7 @@ RMAPI Quaternion FromEuler(Vector3 v)
     return FromEuler(v.x, v.y, v.z);
 }
 
-RMAPI Matrix Scale(Vector3 v)
+RMAPI constexpr Matrix Scale(Vector3 v)
 {
     return Scale(v.x, v.y, v.z);
 }
@@ -2298,132 +2937,132 @@ RMAPI Matrix Scale(Vector3 v)
 // Module Functions Definition - Global operator overloads
 //----------------------------------------------------------------------------------
 
-RMAPI Vector2 operator+(Vector2 a, Vector2 b)
+RMAPI constexpr Vector2 operator+(Vector2 a, Vector2 b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector2 operator-(Vector2 a, Vector2 b)
+RMAPI constexpr Vector2 operator-(Vector2 a, Vector2 b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector2 operator*(Vector2 a, Vector2 b)
+RMAPI constexpr Vector2 operator*(Vector2 a, Vector2 b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector2 operator/(Vector2 a, Vector2 b)
+RMAPI constexpr Vector2 operator/(Vector2 a, Vector2 b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector2 operator+(Vector2 a, float b)
+RMAPI constexpr Vector2 operator+(Vector2 a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector2 operator-(Vector2 a, float b)
+RMAPI constexpr Vector2 operator-(Vector2 a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector2 operator*(Vector2 a, float b)
+RMAPI constexpr Vector2 operator*(Vector2 a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector2 operator/(Vector2 a, float b)
+RMAPI constexpr Vector2 operator/(Vector2 a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Vector3 operator+(Vector3 a, Vector3 b)
+RMAPI constexpr Vector3 operator+(Vector3 a, Vector3 b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector3 operator-(Vector3 a, Vector3 b)
+RMAPI constexpr Vector3 operator-(Vector3 a, Vector3 b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector3 operator*(Vector3 a, Vector3 b)
+RMAPI constexpr Vector3 operator*(Vector3 a, Vector3 b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector3 operator/(Vector3 a, Vector3 b)
+RMAPI constexpr Vector3 operator/(Vector3 a, Vector3 b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector3 operator+(Vector3 a, float b)
+RMAPI constexpr Vector3 operator+(Vector3 a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector3 operator-(Vector3 a, float b)
+RMAPI constexpr Vector3 operator-(Vector3 a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector3 operator*(Vector3 a, float b)
+RMAPI constexpr Vector3 operator*(Vector3 a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector3 operator/(Vector3 a, float b)
+RMAPI constexpr Vector3 operator/(Vector3 a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Vector4 operator+(Vector4 a,  Vector4 b)
+RMAPI constexpr Vector4 operator+(Vector4 a,  Vector4 b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector4 operator-(Vector4 a,  Vector4 b)
+RMAPI constexpr Vector4 operator-(Vector4 a,  Vector4 b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector4 operator*(Vector4 a,  Vector4 b)
+RMAPI constexpr Vector4 operator*(Vector4 a,  Vector4 b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector4 operator/(Vector4 a,  Vector4 b)
+RMAPI constexpr Vector4 operator/(Vector4 a,  Vector4 b)
 {
     return Divide(a, b);
 }
 
-RMAPI Vector4 operator+(Vector4 a, float b)
+RMAPI constexpr Vector4 operator+(Vector4 a, float b)
 {
     return Add(a, b);
 }
 
-RMAPI Vector4 operator-(Vector4 a, float b)
+RMAPI constexpr Vector4 operator-(Vector4 a, float b)
 {
     return Subtract(a, b);
 }
 
-RMAPI Vector4 operator*(Vector4 a, float b)
+RMAPI constexpr Vector4 operator*(Vector4 a, float b)
 {
     return Scale(a, b);
 }
 
-RMAPI Vector4 operator/(Vector4 a, float b)
+RMAPI constexpr Vector4 operator/(Vector4 a, float b)
 {
     return Scale(a, 1.0f / b);
 }
 
-RMAPI Matrix operator+(Matrix a, Matrix b)
+RMAPI constexpr Matrix operator+(Matrix a, Matrix b)
 {
     return Add(a, b);
 }
 
-RMAPI Matrix operator-(Matrix a, Matrix b)
+RMAPI constexpr Matrix operator-(Matrix a, Matrix b)
 {
     return Subtract(a, b);
 }
@@ -2432,93 +3071,103 @@ RMAPI Matrix operator-(Matrix a, Matrix b)
 // Module Functions Definition - Matrix multiplication overloads
 //----------------------------------------------------------------------------------
 
-RMAPI Matrix operator*(Matrix a, Matrix b)
+RMAPI constexpr Matrix operator*(Matrix a, Matrix b)
 {
     return Multiply(a, b);
 }
 
-RMAPI Vector4 operator*(Matrix m, Vector4 v)
+RMAPI constexpr Vector4 operator*(Matrix m, Vector4 v)
 {
     return Multiply(v, m);
 }
 
-RMAPI Vector3 operator*(Matrix m, Vector3 v)
+RMAPI constexpr Vector3 operator*(Matrix m, Vector3 v)
 {
     return Multiply(v, m);
 }
 
-RMAPI Vector2 operator*(Matrix m, Vector2 v)
+RMAPI constexpr Vector2 operator*(Matrix m, Vector2 v)
 {
     return Multiply(v, m);
 }
 
-RMAPI Vector3 operator*(Quaternion a, Vector3 b)
+RMAPI constexpr Vector3 operator*(Quaternion a, Vector3 b)
 {
     // Not part of raylib but uses ToMatrix which is part of raylib
     return Multiply(b, ToMatrix(a));
 }
 
+RMAPI constexpr Affine operator*(Affine a, Affine b)
+{
+    return Multiply(a, b);
+}
+
+RMAPI constexpr Vector3 operator*(Affine m, Vector3 v)
+{
+    return Multiply(v, m);
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Member operator overloads
 //----------------------------------------------------------------------------------
 
-RMAPI Vector2 Vector2::operator+=(Vector2 v)
+RMAPI constexpr Vector2 Vector2::operator+=(Vector2 v)
 {
     x += v.x;
     y += v.y;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator-=(Vector2 v)
+RMAPI constexpr Vector2 Vector2::operator-=(Vector2 v)
 {
     x -= v.x;
     y -= v.y;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator*=(Vector2 v)
+RMAPI constexpr Vector2 Vector2::operator*=(Vector2 v)
 {
     x *= v.x;
     y *= v.y;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator/=(Vector2 v)
+RMAPI constexpr Vector2 Vector2::operator/=(Vector2 v)
 {
     x /= v.x;
     y /= v.y;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator+=(float f)
+RMAPI constexpr Vector2 Vector2::operator+=(float f)
 {
     x += f;
     y += f;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator-=(float f)
+RMAPI constexpr Vector2 Vector2::operator-=(float f)
 {
     x -= f;
     y -= f;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator*=(float f)
+RMAPI constexpr Vector2 Vector2::operator*=(float f)
 {
     x *= f;
     y *= f;
     return *this;
 }
 
-RMAPI Vector2 Vector2::operator/=(float f)
+RMAPI constexpr Vector2 Vector2::operator/=(float f)
 {
     x /= f;
     y /= f;
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator+=(Vector3 v)
+RMAPI constexpr Vector3 Vector3::operator+=(Vector3 v)
 {
     x += v.x;
     y += v.y;
@@ -2526,7 +3175,7 @@ RMAPI Vector3 Vector3::operator+=(Vector3 v)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator-=(Vector3 v)
+RMAPI constexpr Vector3 Vector3::operator-=(Vector3 v)
 {
     x -= v.x;
     y -= v.y;
@@ -2534,7 +3183,7 @@ RMAPI Vector3 Vector3::operator-=(Vector3 v)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator*=(Vector3 v)
+RMAPI constexpr Vector3 Vector3::operator*=(Vector3 v)
 {
     x *= v.x;
     y *= v.y;
@@ -2542,7 +3191,7 @@ RMAPI Vector3 Vector3::operator*=(Vector3 v)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator/=(Vector3 v)
+RMAPI constexpr Vector3 Vector3::operator/=(Vector3 v)
 {
     x /= v.x;
     y /= v.y;
@@ -2550,7 +3199,7 @@ RMAPI Vector3 Vector3::operator/=(Vector3 v)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator+=(float f)
+RMAPI constexpr Vector3 Vector3::operator+=(float f)
 {
     x += f;
     y += f;
@@ -2558,7 +3207,7 @@ RMAPI Vector3 Vector3::operator+=(float f)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator-=(float f)
+RMAPI constexpr Vector3 Vector3::operator-=(float f)
 {
     x -= f;
     y -= f;
@@ -2566,7 +3215,7 @@ RMAPI Vector3 Vector3::operator-=(float f)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator*=(float f)
+RMAPI constexpr Vector3 Vector3::operator*=(float f)
 {
     x *= f;
     y *= f;
@@ -2574,7 +3223,7 @@ RMAPI Vector3 Vector3::operator*=(float f)
     return *this;
 }
 
-RMAPI Vector3 Vector3::operator/=(float f)
+RMAPI constexpr Vector3 Vector3::operator/=(float f)
 {
     x /= f;
     y /= f;
@@ -2582,7 +3231,7 @@ RMAPI Vector3 Vector3::operator/=(float f)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator+=(Vector4 v)
+RMAPI constexpr Vector4 Vector4::operator+=(Vector4 v)
 {
     x += v.x;
     y += v.y;
@@ -2591,7 +3240,7 @@ RMAPI Vector4 Vector4::operator+=(Vector4 v)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator-=(Vector4 v)
+RMAPI constexpr Vector4 Vector4::operator-=(Vector4 v)
 {
     x -= v.x;
     y -= v.y;
@@ -2600,7 +3249,7 @@ RMAPI Vector4 Vector4::operator-=(Vector4 v)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator*=(Vector4 v)
+RMAPI constexpr Vector4 Vector4::operator*=(Vector4 v)
 {
     x *= v.x;
     y *= v.y;
@@ -2609,7 +3258,7 @@ RMAPI Vector4 Vector4::operator*=(Vector4 v)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator/=(Vector4 v)
+RMAPI constexpr Vector4 Vector4::operator/=(Vector4 v)
 {
     x /= v.x;
     y /= v.y;
@@ -2618,7 +3267,7 @@ RMAPI Vector4 Vector4::operator/=(Vector4 v)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator+=(float f)
+RMAPI constexpr Vector4 Vector4::operator+=(float f)
 {
     x += f;
     y += f;
@@ -2627,7 +3276,7 @@ RMAPI Vector4 Vector4::operator+=(float f)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator-=(float f)
+RMAPI constexpr Vector4 Vector4::operator-=(float f)
 {
     x -= f;
     y -= f;
@@ -2636,7 +3285,7 @@ RMAPI Vector4 Vector4::operator-=(float f)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator*=(float f)
+RMAPI constexpr Vector4 Vector4::operator*=(float f)
 {
     x *= f;
     y *= f;
@@ -2645,7 +3294,7 @@ RMAPI Vector4 Vector4::operator*=(float f)
     return *this;
 }
 
-RMAPI Vector4 Vector4::operator/=(float f)
+RMAPI constexpr Vector4 Vector4::operator/=(float f)
 {
     x /= f;
     y /= f;
@@ -2654,22 +3303,51 @@ RMAPI Vector4 Vector4::operator/=(float f)
     return *this;
 }
 
-RMAPI Vector2::operator Vector3() const
+RMAPI constexpr Vector2::operator Vector3() const
 {
     return { x, y, 0.0f };
 }
 
-RMAPI Vector3::operator Vector2() const
+RMAPI constexpr Vector3::operator Vector2() const
 {
     return { x, y };
 }
 
-RMAPI Vector3::operator Vector4() const
+RMAPI constexpr Vector3::operator Vector4() const
 {
     return { x, y, z, 1.0f };
 }
 
-RMAPI Vector4::operator Vector3() const
+RMAPI constexpr Vector4::operator Vector3() const
 {
     return { x, y, z };
 }
+
+//----------------------------------------------------------------------------------
+// Compile-time checks that the constexpr functions fold (values chosen so float math is exact)
+//----------------------------------------------------------------------------------
+static_assert(Dot(V3_RIGHT, V3_UP) == 0.0f, "Dot must be constexpr");
+static_assert(Cross(V3_RIGHT, V3_UP).z == 1.0f, "Cross must be constexpr");
+static_assert(Lerp(V3_ZERO, V3_ONE * 4.0f, 0.5f).y == 2.0f, "Lerp must be constexpr");
+static_assert((Vector2{ 1.0f, 2.0f } + Vector2{ 3.0f, 4.0f }).y == 6.0f, "Vector2 operators must be constexpr");
+static_assert((Vector3{ 1.0f, 2.0f, 3.0f } *= 2.0f).z == 6.0f, "Vector3 operators must be constexpr");
+static_assert((Vector4{ 1.0f, 2.0f, 3.0f, 4.0f } - 1.0f).w == 3.0f, "Vector4 operators must be constexpr");
+
+static_assert(MatrixIdentity().m0 == 1.0f && MatrixIdentity().m12 == 0.0f, "MatrixIdentity must be constexpr");
+static_assert((Scale(2.0f, 2.0f, 2.0f) * Translate(1.0f, 2.0f, 3.0f) * V3_ONE).x == 3.0f, "Matrix * Matrix must be constexpr");
+static_assert((Scale(2.0f, 2.0f, 2.0f) * Translate(1.0f, 2.0f, 3.0f) * V3_ONE).z == 5.0f, "Matrix * Matrix must be constexpr");
+static_assert((Translate(1.0f, 2.0f, 3.0f) * Vector4{ 1.0f, 1.0f, 1.0f, 1.0f }).y == 3.0f, "Matrix * Vector4 must be constexpr");
+static_assert(Translation(Invert(Translate(1.0f, 2.0f, 3.0f))).x == -1.0f, "Invert must be constexpr");
+static_assert(Transpose(Translate(1.0f, 2.0f, 3.0f)).m3 == 1.0f, "Transpose must be constexpr");
+static_assert(Determinant(Scale(2.0f, 3.0f, 4.0f)) == 24.0f, "Determinant must be constexpr");
+static_assert(Ortho(-1.0, 1.0, -1.0, 1.0, -1.0, 1.0).m10 == -1.0f, "Ortho must be constexpr");
+
+static_assert(ToMatrix(QuaternionIdentity()).m5 == 1.0f, "ToMatrix must be constexpr");
+static_assert(Rotate(V3_RIGHT, Quaternion{ 0.0f, 0.0f, 1.0f, 0.0f }).x == -1.0f, "Rotate(Vector3, Quaternion) must be constexpr");
+static_assert(Multiply(Quaternion{ 0.0f, 0.0f, 1.0f, 0.0f }, Quaternion{ 0.0f, 0.0f, 1.0f, 0.0f }).w == -1.0f, "Quaternion multiply must be constexpr");
+
+static_assert(Translation(ToMatrix(ToAffine(Scale(2.0f, 2.0f, 2.0f)) * ToAffine(Translate(1.0f, 2.0f, 3.0f)))).z == 3.0f, "Affine * Affine must be constexpr");
+static_assert((Invert(ToAffine(Scale(2.0f, 4.0f, 8.0f) * Translate(1.0f, 2.0f, 3.0f))) * Vector3{ 3.0f, 6.0f, 11.0f }).z == 1.0f, "Invert(Affine) must be constexpr");
+static_assert(InvertRigid(ToAffine(Translate(1.0f, 2.0f, 3.0f))).m13 == -2.0f, "InvertRigid must be constexpr");
+static_assert(NormalMatrix(ToAffine(Scale(2.0f, 4.0f, 8.0f))).m5 == 0.25f, "NormalMatrix(Affine) must be constexpr");
+static_assert(Translation(AffineScale(2.0f, 2.0f, 2.0f) * AffineTranslate(1.0f, 2.0f, 3.0f)).z == 3.0f, "AffineTranslate and AffineScale must be constexpr");
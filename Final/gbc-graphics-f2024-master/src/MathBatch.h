@@ -0,0 +1,264 @@
+#pragma once
+#include "Math.h"
+
+//----------------------------------------------------------------------------------
+// Batch (structure-of-arrays) versions of the Math.h functions used to animate many objects at once.
+//
+// Each component lives in its own contiguous float array, so the SSE path (see MATH_SSE in Math.h) handles
+// 4 objects per instruction with no shuffling. The remainder, and every object on other targets, goes through
+// a scalar loop. Results match the single-object versions exactly, they use the same operations in the same order.
+//
+// Output arrays may be the same as input arrays (ie Normalize in place), but must not partially overlap them.
+//
+// NOTE: Slerp has no SSE path since acosf and sinf have no SSE equivalent. Its loop is branch-free so
+// compilers with a vector math library can still vectorize it (ie GCC with -O3 -ffast-math).
+//----------------------------------------------------------------------------------
+
+typedef struct Vector3SoA {
+    float* x;
+    float* y;
+    float* z;
+} Vector3SoA;
+
+typedef struct QuaternionSoA {
+    float* x;
+    float* y;
+    float* z;
+    float* w;
+} QuaternionSoA;
+
+// Transform count points by a matrix, same as Multiply(Vector3, Matrix) (w = 1)
+RMAPI void Transform(Matrix mat, Vector3SoA points, Vector3SoA result, int count)
+{
+    int i = 0;
+#ifdef MATH_SSE
+    __m128 m0 = _mm_set1_ps(mat.m0), m4 = _mm_set1_ps(mat.m4), m8 = _mm_set1_ps(mat.m8), m12 = _mm_set1_ps(mat.m12);
+    __m128 m1 = _mm_set1_ps(mat.m1), m5 = _mm_set1_ps(mat.m5), m9 = _mm_set1_ps(mat.m9), m13 = _mm_set1_ps(mat.m13);
+    __m128 m2 = _mm_set1_ps(mat.m2), m6 = _mm_set1_ps(mat.m6), m10 = _mm_set1_ps(mat.m10), m14 = _mm_set1_ps(mat.m14);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(points.x + i);
+        __m128 y = _mm_loadu_ps(points.y + i);
+        __m128 z = _mm_loadu_ps(points.z + i);
+
+        __m128 rx = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m0, x), _mm_mul_ps(m4, y)), _mm_mul_ps(m8, z)), m12);
+        __m128 ry = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m1, x), _mm_mul_ps(m5, y)), _mm_mul_ps(m9, z)), m13);
+        __m128 rz = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(m2, x), _mm_mul_ps(m6, y)), _mm_mul_ps(m10, z)), m14);
+
+        _mm_storeu_ps(result.x + i, rx);
+        _mm_storeu_ps(result.y + i, ry);
+        _mm_storeu_ps(result.z + i, rz);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        float x = points.x[i];
+        float y = points.y[i];
+        float z = points.z[i];
+
+        result.x[i] = mat.m0 * x + mat.m4 * y + mat.m8 * z + mat.m12;
+        result.y[i] = mat.m1 * x + mat.m5 * y + mat.m9 * z + mat.m13;
+        result.z[i] = mat.m2 * x + mat.m6 * y + mat.m10 * z + mat.m14;
+    }
+}
+
+// Build count world matrices from translation, rotation and scale, same as Scale(s) * ToMatrix(r) * Translate(t)
+RMAPI void Compose(Vector3SoA translations, QuaternionSoA rotations, Vector3SoA scales, Matrix* result, int count)
+{
+    int i = 0;
+#ifdef MATH_SSE
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+    __m128 two = _mm_set1_ps(2.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 qx = _mm_loadu_ps(rotations.x + i);
+        __m128 qy = _mm_loadu_ps(rotations.y + i);
+        __m128 qz = _mm_loadu_ps(rotations.z + i);
+        __m128 qw = _mm_loadu_ps(rotations.w + i);
+        __m128 sx = _mm_loadu_ps(scales.x + i);
+        __m128 sy = _mm_loadu_ps(scales.y + i);
+        __m128 sz = _mm_loadu_ps(scales.z + i);
+
+        __m128 a2 = _mm_mul_ps(qx, qx);
+        __m128 b2 = _mm_mul_ps(qy, qy);
+        __m128 c2 = _mm_mul_ps(qz, qz);
+        __m128 ac = _mm_mul_ps(qx, qz);
+        __m128 ab = _mm_mul_ps(qx, qy);
+        __m128 bc = _mm_mul_ps(qy, qz);
+        __m128 ad = _mm_mul_ps(qw, qx);
+        __m128 bd = _mm_mul_ps(qw, qy);
+        __m128 cd = _mm_mul_ps(qw, qz);
+
+        // Each register holds one element of 4 matrices
+        __m128 m0 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(b2, c2))), sx);
+        __m128 m1 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(ab, cd)), sx);
+        __m128 m2 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(ac, bd)), sx);
+        __m128 m3 = zero;
+
+        __m128 m4 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(ab, cd)), sy);
+        __m128 m5 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(a2, c2))), sy);
+        __m128 m6 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(bc, ad)), sy);
+        __m128 m7 = zero;
+
+        __m128 m8 = _mm_mul_ps(_mm_mul_ps(two, _mm_add_ps(ac, bd)), sz);
+        __m128 m9 = _mm_mul_ps(_mm_mul_ps(two, _mm_sub_ps(bc, ad)), sz);
+        __m128 m10 = _mm_mul_ps(_mm_sub_ps(one, _mm_mul_ps(two, _mm_add_ps(a2, b2))), sz);
+        __m128 m11 = zero;
+
+        __m128 m12 = _mm_loadu_ps(translations.x + i);
+        __m128 m13 = _mm_loadu_ps(translations.y + i);
+        __m128 m14 = _mm_loadu_ps(translations.z + i);
+        __m128 m15 = one;
+
+        // Transposing turns "element of 4 matrices" into "row of 1 matrix"
+        _MM_TRANSPOSE4_PS(m0, m4, m8, m12);
+        _MM_TRANSPOSE4_PS(m1, m5, m9, m13);
+        _MM_TRANSPOSE4_PS(m2, m6, m10, m14);
+        _MM_TRANSPOSE4_PS(m3, m7, m11, m15);
+
+        _mm_storeu_ps(&result[i + 0].m0, m0);
+        _mm_storeu_ps(&result[i + 0].m1, m1);
+        _mm_storeu_ps(&result[i + 0].m2, m2);
+        _mm_storeu_ps(&result[i + 0].m3, m3);
+
+        _mm_storeu_ps(&result[i + 1].m0, m4);
+        _mm_storeu_ps(&result[i + 1].m1, m5);
+        _mm_storeu_ps(&result[i + 1].m2, m6);
+        _mm_storeu_ps(&result[i + 1].m3, m7);
+
+        _mm_storeu_ps(&result[i + 2].m0, m8);
+        _mm_storeu_ps(&result[i + 2].m1, m9);
+        _mm_storeu_ps(&result[i + 2].m2, m10);
+        _mm_storeu_ps(&result[i + 2].m3, m11);
+
+        _mm_storeu_ps(&result[i + 3].m0, m12);
+        _mm_storeu_ps(&result[i + 3].m1, m13);
+        _mm_storeu_ps(&result[i + 3].m2, m14);
+        _mm_storeu_ps(&result[i + 3].m3, m15);
+    }
+#endif
+    for (; i < count; i++)
+    {
+        float qx = rotations.x[i];
+        float qy = rotations.y[i];
+        float qz = rotations.z[i];
+        float qw = rotations.w[i];
+        float sx = scales.x[i];
+        float sy = scales.y[i];
+        float sz = scales.z[i];
+
+        // ToMatrix(Quaternion)
+        float a2 = qx * qx;
+        float b2 = qy * qy;
+        float c2 = qz * qz;
+        float ac = qx * qz;
+        float ab = qx * qy;
+        float bc = qy * qz;
+        float ad = qw * qx;
+        float bd = qw * qy;
+        float cd = qw * qz;
+
+        // Scaling multiplies each basis vector of the rotation
+        Matrix& m = result[i];
+        m.m0 = (1 - 2 * (b2 + c2)) * sx;
+        m.m1 = (2 * (ab + cd)) * sx;
+        m.m2 = (2 * (ac - bd)) * sx;
+        m.m3 = 0.0f;
+
+        m.m4 = (2 * (ab - cd)) * sy;
+        m.m5 = (1 - 2 * (a2 + c2)) * sy;
+        m.m6 = (2 * (bc + ad)) * sy;
+        m.m7 = 0.0f;
+
+        m.m8 = (2 * (ac + bd)) * sz;
+        m.m9 = (2 * (bc - ad)) * sz;
+        m.m10 = (1 - 2 * (a2 + b2)) * sz;
+        m.m11 = 0.0f;
+
+        m.m12 = translations.x[i];
+        m.m13 = translations.y[i];
+        m.m14 = translations.z[i];
+        m.m15 = 1.0f;
+    }
+}
+
+// Spherical linear interpolation of count quaternion pairs, same as Slerp(q1, q2, amount)
+RMAPI void Slerp(QuaternionSoA q1, QuaternionSoA q2, const float* amounts, QuaternionSoA result, int count)
+{
+    // Every case of the single-object version is computed and the right one selected, so there are no branches
+    for (int i = 0; i < count; i++)
+    {
+        float x1 = q1.x[i], y1 = q1.y[i], z1 = q1.z[i], w1 = q1.w[i];
+        float x2 = q2.x[i], y2 = q2.y[i], z2 = q2.z[i], w2 = q2.w[i];
+        float amount = amounts[i];
+
+        float cosHalfTheta = x1 * x2 + y1 * y2 + z1 * z2 + w1 * w2;
+        float sign = cosHalfTheta < 0 ? -1.0f : 1.0f;
+        x2 *= sign; y2 *= sign; z2 *= sign; w2 *= sign;
+        cosHalfTheta *= sign;
+
+        // Nlerp(q1, q2, amount)
+        float nx = x1 + amount * (x2 - x1);
+        float ny = y1 + amount * (y2 - y1);
+        float nz = z1 + amount * (z2 - z1);
+        float nw = w1 + amount * (w2 - w1);
+        float length = sqrtf(nx * nx + ny * ny + nz * nz + nw * nw);
+        length = length == 0.0f ? 1.0f : length;
+        float ilength = 1.0f / length;
+
+        // Clamped so acosf and sqrtf stay in range for the lanes that won't use them
+        float cosClamped = fminf(cosHalfTheta, 1.0f);
+        float halfTheta = acosf(cosClamped);
+        float sinHalfTheta = sqrtf(1.0f - cosClamped * cosClamped);
+        bool midpoint = fabsf(sinHalfTheta) < 0.001f;
+        float ratioA = midpoint ? 0.5f : sinf((1 - amount) * halfTheta) / sinHalfTheta;
+        float ratioB = midpoint ? 0.5f : sinf(amount * halfTheta) / sinHalfTheta;
+
+        bool same = cosHalfTheta >= 1.0f;
+        bool nlerp = cosHalfTheta > 0.95f;
+        result.x[i] = same ? x1 : nlerp ? nx * ilength : x1 * ratioA + x2 * ratioB;
+        result.y[i] = same ? y1 : nlerp ? ny * ilength : y1 * ratioA + y2 * ratioB;
+        result.z[i] = same ? z1 : nlerp ? nz * ilength : z1 * ratioA + z2 * ratioB;
+        result.w[i] = same ? w1 : nlerp ? nw * ilength : w1 * ratioA + w2 * ratioB;
+    }
+}
+
+// Normalize count vectors, same as Normalize(Vector3)
+RMAPI void Normalize(Vector3SoA v, Vector3SoA result, int count)
+{
+    int i = 0;
+#ifdef MATH_SSE
+    __m128 zero = _mm_setzero_ps();
+    __m128 one = _mm_set1_ps(1.0f);
+    for (; i + 4 <= count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(v.x + i);
+        __m128 y = _mm_loadu_ps(v.y + i);
+        __m128 z = _mm_loadu_ps(v.z + i);
+
+        __m128 length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        __m128 isZero = _mm_cmpeq_ps(length, zero);
+        length = _mm_or_ps(_mm_and_ps(isZero, one), _mm_andnot_ps(isZero, length));
+        __m128 ilength = _mm_div_ps(one, length);
+
+        _mm_storeu_ps(result.x + i, _mm_mul_ps(x, ilength));
+        _mm_storeu_ps(result.y + i, _mm_mul_ps(y, ilength));
+        _mm_storeu_ps(result.z + i, _mm_mul_ps(z, ilength));
+    }
+#endif
+    for (; i < count; i++)
+    {
+        float x = v.x[i];
+        float y = v.y[i];
+        float z = v.z[i];
+
+        float length = sqrtf(x * x + y * y + z * z);
+        length = length == 0.0f ? 1.0f : length;
+        float ilength = 1.0f / length;
+
+        result.x[i] = x * ilength;
+        result.y[i] = y * ilength;
+        result.z[i] = z * ilength;
+    }
+}
@@ -2,6 +2,7 @@
 #include <glad/glad.h>
 #include <vector>
 #include "Math.h"
+#include "MeshCache.h"
 
 enum ShapeType
 {
@@ -10,6 +11,20 @@ enum ShapeType
 	SPHERE
 };
 
+enum VertexLayout
+{
+	SEPARATE,	// One buffer per attribute (pbo, nbo, tbo)
+	INTERLEAVED	// One buffer of Vertex structs (vbo)
+};
+
+// Interleaved vertex. Attribute locations are 0 = position, 1 = normal, 2 = tcoord for both layouts.
+struct Vertex
+{
+	Vector3 position;
+	Vector3 normal;
+	Vector2 tcoord;
+};
+
 struct Mesh
 {
 	// Number of triangle points in our mesh
@@ -20,18 +35,59 @@ struct Mesh
 	std::vector<Vector3> positions;
 	std::vector<Vector3> normals;
 	std::vector<Vector2> tcoords;
-	std::vector<uint16_t> indices;
+
+	// Only one of these is filled. 16-bit indices are used whenever the vertex count allows it.
+	std::vector<uint16_t> indices16;
+	std::vector<uint32_t> indices32;
+	GLenum indexType = GL_NONE;	// GL_UNSIGNED_SHORT, GL_UNSIGNED_INT, or GL_NONE if unindexed
+
+	// Object-space bounds, computed whenever positions are filled
+	BoundingBox box{};
+	BoundingSphere sphere{};
 
 	// GPU data
+	VertexLayout layout = SEPARATE;
 	GLuint vao = GL_NONE;	// Vertex array object
+	GLuint vbo = GL_NONE;	// Vertex buffer object (interleaved layout only)
 	GLuint pbo = GL_NONE;	// Position buffer object
 	GLuint nbo = GL_NONE;	// Normals buffer object
 	GLuint tbo = GL_NONE;	// Tcoords buffer object
 	GLuint ebo = GL_NONE;	// Element buffer object (indices)
 };
 
-void CreateMesh(Mesh* mesh, const char* path);
-void CreateMesh(Mesh* mesh, ShapeType shape);
+// LoadMesh, LoadShape, GetStreams, Interleave, SetIndices and IsInFrustum only touch CPU data.
+// They live in MeshData.cpp, which builds without glad or a GL context; the rest are in Mesh.cpp.
+
+void CreateMesh(Mesh* mesh, const char* path, VertexLayout layout = SEPARATE);
+void CreateMesh(Mesh* mesh, ShapeType shape, VertexLayout layout = SEPARATE);
 void DestroyMesh(Mesh* mesh);
 
-void DrawMesh(const Mesh& mesh);
\ No newline at end of file
+// Fills the mesh's CPU data without touching OpenGL, so it can run on any thread.
+// Call Upload on the GL thread afterwards. Until then, DrawMesh draws nothing.
+void LoadMesh(Mesh* mesh, const char* path, VertexLayout layout = SEPARATE);
+void LoadShape(Mesh* mesh, ShapeType shape, VertexLayout layout = SEPARATE);
+void Upload(Mesh* mesh);
+
+// Points into the mesh's CPU data
+MeshStreams GetStreams(const Mesh& mesh);
+
+// Vertices in the INTERLEAVED layout. Missing tcoords are zero-filled so every vertex has the same size.
+std::vector<Vertex> Interleave(const MeshStreams& streams);
+
+// Stores indices as 16-bit if every vertex can be addressed with 16 bits, otherwise as 32-bit.
+// Must be called after the mesh's positions have been filled.
+void SetIndices(Mesh* mesh, const uint32_t* indices, int count);
+
+// Leaves the mesh's vao bound, so consecutive draws of the same mesh don't rebind it
+void DrawMesh(const Mesh& mesh);
+
+// Draws count copies of the mesh in one call. The program reads each copy's data from the instance buffer
+// at gl_BaseInstance + gl_InstanceID, so first selects where this draw's instances start (see default_instanced.vert).
+void DrawMeshInstanced(const Mesh& mesh, int count, int first = 0);
+
+// Tests the mesh's bounds in world space against the frustum
+bool IsInFrustum(const Mesh& mesh, Affine world, const ViewFrustum& frustum);
+
+// IsInFrustum that also counts the result in gRenderStats.
+// Skip the draw (and its uniforms) when this returns false. Meshes without data yet (still loading) return false uncounted.
+bool IsVisible(const Mesh& mesh, Affine world, const ViewFrustum& frustum);
\ No newline at end of file
@@ -0,0 +1,302 @@
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <sys/stat.h>
+#include "MeshCache.h"
+#include <cstdio>
+#include <string>
+
+static std::string GetCachePath(const char* sourcePath)
+{
+	return std::string(sourcePath) + ".cache";
+}
+
+static bool GetFileInfo(const char* path, uint64_t* size, int64_t* time)
+{
+#ifdef _WIN32
+	struct _stat64 info;
+	if (_stat64(path, &info) != 0)
+		return false;
+#else
+	struct stat info;
+	if (stat(path, &info) != 0)
+		return false;
+#endif
+	*size = (uint64_t)info.st_size;
+	*time = (int64_t)info.st_mtime;
+	return true;
+}
+
+static uint64_t HashFile(const char* path)
+{
+	uint64_t hash = 14695981039346656037ull;
+	MappedFile file;
+	if (MapFile(&file, path))
+	{
+		for (size_t i = 0; i < file.size; i++)
+		{
+			hash ^= file.data[i];
+			hash *= 1099511628211ull;
+		}
+		UnmapFile(&file);
+	}
+	return hash;
+}
+
+static size_t GetIndexSize(uint32_t indexType)
+{
+	switch (indexType)
+	{
+	case GL_UNSIGNED_SHORT:
+		return sizeof(uint16_t);
+
+	case GL_UNSIGNED_INT:
+		return sizeof(uint32_t);
+
+	default:
+		return 0;
+	}
+}
+
+// Size the cache file must have given its header. Anything else means a truncated or foreign file.
+static size_t GetCacheSize(const MeshCacheHeader& header)
+{
+	size_t size = sizeof(MeshCacheHeader);
+	size += header.vertexCount * sizeof(Vector3) * 2;
+	if (header.flags & MESH_CACHE_TCOORDS)
+		size += header.vertexCount * sizeof(Vector2);
+	size += header.indexCount * GetIndexSize(header.indexType);
+	return size;
+}
+
+// Every index must address a vertex, otherwise a corrupt cache would make draws read past the vertex buffers.
+// Must only be called for indexed meshes with a valid index type.
+static bool IndicesInRange(const MeshCacheHeader& header, const uint8_t* indices)
+{
+	uint32_t last = 0;
+	if (header.indexType == GL_UNSIGNED_SHORT)
+	{
+		const uint16_t* indices16 = (const uint16_t*)indices;
+		for (uint32_t i = 0; i < header.indexCount; i++)
+			last = indices16[i] > last ? indices16[i] : last;
+	}
+	else
+	{
+		const uint32_t* indices32 = (const uint32_t*)indices;
+		for (uint32_t i = 0; i < header.indexCount; i++)
+			last = indices32[i] > last ? indices32[i] : last;
+	}
+	return last < header.vertexCount;
+}
+
+bool MapFile(MappedFile* file, const char* path)
+{
+	*file = MappedFile{};
+#ifdef _WIN32
+	HANDLE handle = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+	if (handle == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(handle, &size))
+	{
+		CloseHandle(handle);
+		return false;
+	}
+
+	// Empty files can't be mapped, but are still valid files
+	if (size.QuadPart == 0)
+	{
+		CloseHandle(handle);
+		return true;
+	}
+
+	HANDLE mapping = CreateFileMappingA(handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	const void* data = mapping != nullptr ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+	if (data == nullptr)
+	{
+		if (mapping != nullptr)
+			CloseHandle(mapping);
+		CloseHandle(handle);
+		return false;
+	}
+
+	file->data = (const uint8_t*)data;
+	file->size = (size_t)size.QuadPart;
+	file->file = handle;
+	file->mapping = mapping;
+#else
+	int fd = open(path, O_RDONLY);
+	if (fd == -1)
+		return false;
+
+	struct stat info;
+	if (fstat(fd, &info) != 0)
+	{
+		close(fd);
+		return false;
+	}
+
+	if (info.st_size == 0)
+	{
+		close(fd);
+		return true;
+	}
+
+	// The mapping stays valid after the descriptor is closed
+	void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return false;
+
+	file->data = (const uint8_t*)data;
+	file->size = (size_t)info.st_size;
+#endif
+	return true;
+}
+
+void UnmapFile(MappedFile* file)
+{
+#ifdef _WIN32
+	if (file->data != nullptr)
+		UnmapViewOfFile(file->data);
+	if (file->mapping != nullptr)
+		CloseHandle(file->mapping);
+	if (file->file != nullptr)
+		CloseHandle(file->file);
+#else
+	if (file->data != nullptr)
+		munmap((void*)file->data, file->size);
+#endif
+	*file = MappedFile{};
+}
+
+bool OpenMeshCache(MappedFile* cache, const char* sourcePath, MeshStreams* streams)
+{
+	uint64_t sourceSize;
+	int64_t sourceTime;
+	if (!GetFileInfo(sourcePath, &sourceSize, &sourceTime))
+		return false;
+
+	std::string path = GetCachePath(sourcePath);
+	if (!MapFile(cache, path.c_str()))
+		return false;
+
+	const MeshCacheHeader* header = (const MeshCacheHeader*)cache->data;
+	bool valid = cache->size >= sizeof(MeshCacheHeader) &&
+		header->magic == MESH_CACHE_MAGIC &&
+		header->version == MESH_CACHE_VERSION &&
+		header->sourceSize == sourceSize &&
+		(header->indexCount == 0 || GetIndexSize(header->indexType) != 0) &&
+		cache->size == GetCacheSize(*header);
+
+	// A new timestamp doesn't always mean new contents (ie the asset was checked out again).
+	// If the contents match, record the new timestamp so we don't have to hash the source next time.
+	if (valid && header->sourceTime != sourceTime)
+	{
+		valid = header->sourceHash == HashFile(sourcePath);
+		if (valid)
+		{
+			MeshCacheHeader patched = *header;
+			patched.sourceTime = sourceTime;
+			UnmapFile(cache);
+
+			FILE* file = fopen(path.c_str(), "r+b");
+			if (file != nullptr)
+			{
+				fwrite(&patched, sizeof(patched), 1, file);
+				fclose(file);
+			}
+
+			if (!MapFile(cache, path.c_str()))
+				return false;
+			header = (const MeshCacheHeader*)cache->data;
+		}
+	}
+
+	// Indices are the last stream in the file
+	if (valid && header->indexCount > 0 &&
+		!IndicesInRange(*header, cache->data + cache->size - header->indexCount * GetIndexSize(header->indexType)))
+	{
+		printf("**Warning: mesh cache %s has out-of-range indices, reloading the source**\n", path.c_str());
+		valid = false;
+	}
+
+	if (!valid)
+	{
+		UnmapFile(cache);
+		return false;
+	}
+
+	const uint8_t* data = cache->data + sizeof(MeshCacheHeader);
+	*streams = MeshStreams{};
+	streams->vertexCount = header->vertexCount;
+	streams->indexCount = header->indexCount;
+	streams->indexType = header->indexType;
+
+	streams->positions = (const Vector3*)data;
+	data += header->vertexCount * sizeof(Vector3);
+	streams->normals = (const Vector3*)data;
+	data += header->vertexCount * sizeof(Vector3);
+	if (header->flags & MESH_CACHE_TCOORDS)
+	{
+		streams->tcoords = (const Vector2*)data;
+		data += header->vertexCount * sizeof(Vector2);
+	}
+	if (header->indexCount > 0)
+		streams->indices = data;
+
+	return true;
+}
+
+void CloseMeshCache(MappedFile* cache)
+{
+	UnmapFile(cache);
+}
+
+void WriteMeshCache(const char* sourcePath, const MeshStreams& streams)
+{
+	MeshCacheHeader header{};
+	header.magic = MESH_CACHE_MAGIC;
+	header.version = MESH_CACHE_VERSION;
+	if (!GetFileInfo(sourcePath, &header.sourceSize, &header.sourceTime))
+		return;
+	header.sourceHash = HashFile(sourcePath);
+	header.vertexCount = streams.vertexCount;
+	header.indexCount = streams.indices != nullptr ? streams.indexCount : 0;
+	header.indexType = streams.indices != nullptr ? streams.indexType : GL_NONE;
+	header.flags = streams.tcoords != nullptr ? MESH_CACHE_TCOORDS : 0;
+
+	// Write to a temporary file first so a crash mid-write never leaves a valid-looking cache behind
+	std::string path = GetCachePath(sourcePath);
+	std::string temp = path + ".tmp";
+	FILE* file = fopen(temp.c_str(), "wb");
+	if (file == nullptr)
+	{
+		printf("**Warning: could not write mesh cache %s**\n", path.c_str());
+		return;
+	}
+
+	bool success = fwrite(&header, sizeof(header), 1, file) == 1;
+	success &= fwrite(streams.positions, sizeof(Vector3), header.vertexCount, file) == header.vertexCount;
+	success &= fwrite(streams.normals, sizeof(Vector3), header.vertexCount, file) == header.vertexCount;
+	if (streams.tcoords != nullptr)
+		success &= fwrite(streams.tcoords, sizeof(Vector2), header.vertexCount, file) == header.vertexCount;
+	if (header.indexCount > 0)
+		success &= fwrite(streams.indices, GetIndexSize(header.indexType), header.indexCount, file) == header.indexCount;
+	success &= fclose(file) == 0;
+
+	// rename won't replace an existing file on Windows
+	remove(path.c_str());
+	if (!success || rename(temp.c_str(), path.c_str()) != 0)
+	{
+		remove(temp.c_str());
+		printf("**Warning: could not write mesh cache %s**\n", path.c_str());
+	}
+}
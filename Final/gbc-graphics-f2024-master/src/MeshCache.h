@@ -0,0 +1,61 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstddef>
+#include <cstdint>
+#include "Math.h"
+
+// Binary mesh cache written next to an OBJ (ie "head.obj" -> "head.obj.cache") so later runs skip parsing.
+// Layout: MeshCacheHeader, positions, normals, tcoords (if MESH_CACHE_TCOORDS), indices.
+constexpr uint32_t MESH_CACHE_MAGIC = 0x4853454D;	// "MESH"
+constexpr uint32_t MESH_CACHE_VERSION = 1;
+constexpr uint32_t MESH_CACHE_TCOORDS = 1 << 0;
+
+struct MeshCacheHeader
+{
+	uint32_t magic;
+	uint32_t version;
+
+	// Source OBJ the cache was built from. The cache is rebuilt if any of these change.
+	uint64_t sourceSize;
+	int64_t sourceTime;		// Last modified time
+	uint64_t sourceHash;	// FNV-1a of the file's contents
+
+	uint32_t vertexCount;
+	uint32_t indexCount;
+	uint32_t indexType;		// GL_UNSIGNED_SHORT or GL_UNSIGNED_INT
+	uint32_t flags;
+};
+static_assert(sizeof(MeshCacheHeader) == 48, "MeshCacheHeader must have no padding");
+
+// Pointers to a mesh's vertex streams and indices, either into a Mesh's vectors or into a mapped cache
+struct MeshStreams
+{
+	const Vector3* positions = nullptr;
+	const Vector3* normals = nullptr;
+	const Vector2* tcoords = nullptr;	// nullptr if the mesh has no texture coordinates
+	const void* indices = nullptr;		// nullptr if the mesh is unindexed
+	int vertexCount = 0;
+	int indexCount = 0;
+	GLenum indexType = GL_NONE;
+};
+
+// Read-only memory-mapped file
+struct MappedFile
+{
+	const uint8_t* data = nullptr;
+	size_t size = 0;
+	void* file = nullptr;		// Win32 file handle
+	void* mapping = nullptr;	// Win32 file mapping handle
+};
+
+bool MapFile(MappedFile* file, const char* path);
+void UnmapFile(MappedFile* file);
+
+// Maps the cache for the given source OBJ and points streams into it.
+// Returns false if the cache is missing, corrupt (including indices past the last vertex) or was built from a different version of the source.
+// The streams are only valid until CloseMeshCache.
+bool OpenMeshCache(MappedFile* cache, const char* sourcePath, MeshStreams* streams);
+void CloseMeshCache(MappedFile* cache);
+
+// (Re)builds the cache for the given source OBJ
+void WriteMeshCache(const char* sourcePath, const MeshStreams& streams);
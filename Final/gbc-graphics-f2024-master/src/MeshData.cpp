@@ -0,0 +1,384 @@
+#define PAR_SHAPES_IMPLEMENTATION
+#define FAST_OBJ_IMPLEMENTATION
+#include <par_shapes.h>
+#include <fast_obj.h>
+#include "Mesh.h"
+#include "MeshCache.h"
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+
+// Everything in Mesh.h that only reads or writes CPU data.
+// OpenGL calls stay in Mesh.cpp so SoftBench can link this file on its own.
+
+void LoadObj(Mesh* mesh, const char* path);
+static void GenCube(Mesh* mesh, float width, float height, float length);
+
+// Welds identical (position, normal, tcoord) index triples into a single vertex.
+// Writes one index per corner into corners and returns the unique triples.
+static std::vector<fastObjIndex> Weld(const fastObjMesh* obj, std::vector<uint32_t>& corners)
+{
+	int count = obj->index_count;
+	corners.resize(count);
+
+	std::vector<fastObjIndex> unique;
+	unique.reserve(count / 3);
+
+	// Open-addressing hash table of indices into unique, sized to stay under 50% full
+	uint32_t capacity = 1;
+	while (capacity < (uint32_t)count * 2)
+		capacity <<= 1;
+	std::vector<uint32_t> table(capacity, UINT32_MAX);
+
+	for (int i = 0; i < count; i++)
+	{
+		fastObjIndex idx = obj->indices[i];
+		uint32_t hash = (idx.p * 73856093u) ^ (idx.n * 19349663u) ^ (idx.t * 83492791u);
+		uint32_t slot = hash & (capacity - 1);
+		while (true)
+		{
+			uint32_t vertex = table[slot];
+			if (vertex == UINT32_MAX)
+			{
+				vertex = (uint32_t)unique.size();
+				unique.push_back(idx);
+				table[slot] = vertex;
+				corners[i] = vertex;
+				break;
+			}
+
+			fastObjIndex other = unique[vertex];
+			if (other.p == idx.p && other.n == idx.n && other.t == idx.t)
+			{
+				corners[i] = vertex;
+				break;
+			}
+			slot = (slot + 1) & (capacity - 1);
+		}
+	}
+
+	return unique;
+}
+
+static void ComputeBounds(Mesh* mesh)
+{
+	mesh->box = ToBoundingBox(mesh->positions.data(), (int)mesh->positions.size());
+	mesh->sphere = ToBoundingSphere(mesh->positions.data(), (int)mesh->positions.size());
+}
+
+// Copies a mapped cache into the mesh's CPU data
+void CopyStreams(Mesh* mesh, const MeshStreams& streams)
+{
+	int vertexCount = streams.vertexCount;
+	mesh->positions.assign(streams.positions, streams.positions + vertexCount);
+	mesh->normals.assign(streams.normals, streams.normals + vertexCount);
+	if (streams.tcoords != nullptr)
+		mesh->tcoords.assign(streams.tcoords, streams.tcoords + vertexCount);
+
+	mesh->indexType = streams.indexType;
+	if (streams.indexType == GL_UNSIGNED_SHORT)
+		mesh->indices16.assign((const uint16_t*)streams.indices, (const uint16_t*)streams.indices + streams.indexCount);
+	else if (streams.indexType == GL_UNSIGNED_INT)
+		mesh->indices32.assign((const uint32_t*)streams.indices, (const uint32_t*)streams.indices + streams.indexCount);
+	mesh->count = streams.indices != nullptr ? streams.indexCount : vertexCount;
+	ComputeBounds(mesh);
+}
+
+void LoadMesh(Mesh* mesh, const char* path, VertexLayout layout)
+{
+	mesh->layout = layout;
+
+	MappedFile cache;
+	MeshStreams streams;
+	if (OpenMeshCache(&cache, path, &streams))
+	{
+		CopyStreams(mesh, streams);
+		CloseMeshCache(&cache);
+		printf("Mesh %s: loaded %i vertices from cache\n", path, streams.vertexCount);
+		return;
+	}
+
+	LoadObj(mesh, path);
+}
+
+// Parses and welds an OBJ into the mesh's CPU data, then (re)builds its cache
+void LoadObj(Mesh* mesh, const char* path)
+{
+	fastObjMesh* obj = fast_obj_read(path);
+	int count = obj->index_count;
+
+	std::vector<uint32_t> corners;
+	std::vector<fastObjIndex> unique = Weld(obj, corners);
+	int vertexCount = (int)unique.size();
+	mesh->positions.resize(vertexCount);
+	mesh->normals.resize(vertexCount);
+	
+	assert(obj->position_count > 1);
+	for (int i = 0; i < vertexCount; i++)
+	{
+		// Using the welded indices, populate the mesh->positions with the object's vertex positions
+		fastObjIndex idx = unique[i];
+		// A way to point to what p, n and t holds
+		
+		mesh->positions[i].x = obj->positions[idx.p * 3 + 0];
+		mesh->positions[i].y = obj->positions[idx.p * 3 + 1];
+		mesh->positions[i].z = obj->positions[idx.p * 3 + 2];
+	}
+	
+	assert(obj->normal_count > 1);
+	for (int i = 0; i < vertexCount; i++)
+	{
+		// Using the welded indices, populate the mesh->normals with the object's vertex normals
+		fastObjIndex idx = unique[i];
+
+		mesh->normals[i].x = obj->normals[idx.n * 3 + 0];
+		mesh->normals[i].y = obj->normals[idx.n * 3 + 1];
+		mesh->normals[i].z = obj->normals[idx.n * 3 + 2];
+	}
+	
+	if (obj->texcoord_count > 1)
+	{
+		mesh->tcoords.resize(vertexCount);
+		for (int i = 0; i < vertexCount; i++)
+		{
+			// Using the welded indices, populate the mesh->tcoords with the object's vertex texture coordinates
+			fastObjIndex idx = unique[i];
+			mesh->tcoords[i].x = obj->texcoords[idx.t * 2 + 0];
+			mesh->tcoords[i].y = obj->texcoords[idx.t * 2 + 1];
+		}
+	}
+	else
+	{
+		printf("**Warning: mesh %s loaded without texture coordinates**\n", path);
+	}
+	fast_obj_destroy(obj);
+	ComputeBounds(mesh);
+
+	SetIndices(mesh, corners.data(), count);
+	printf("Mesh %s: welded %i vertices into %i (%.2fx smaller), %i-bit indices\n",
+		path, count, vertexCount, count / (float)vertexCount, mesh->indexType == GL_UNSIGNED_SHORT ? 16 : 32);
+	mesh->count = count;
+
+	WriteMeshCache(path, GetStreams(*mesh));
+}
+
+void LoadShape(Mesh* mesh, ShapeType shape, VertexLayout layout)
+{
+	mesh->layout = layout;
+
+	// 1. Generate par_shapes_mesh
+	par_shapes_mesh* par = nullptr;
+	switch (shape)
+	{
+	case PLANE:
+		par = par_shapes_create_plane(1, 1);
+		break;
+
+	case CUBE:
+		//par = par_shapes_create_cube(); // Cannot use because par platonic solids work differently than par parametrics
+		break;
+
+	case SPHERE:
+		par = par_shapes_create_parametric_sphere(8, 8);
+		break;
+
+	default:
+		assert(false && "Invalid shape type");
+		break;
+	}
+	if (par != nullptr)
+	{
+		par_shapes_compute_normals(par);
+
+		// 2. Convert par_shapes_mesh to our Mesh representation
+		int count = par->ntriangles * 3;	// 3 points per triangle
+		mesh->count = count;
+		mesh->positions.resize(par->npoints);
+		memcpy(mesh->positions.data(), par->points, par->npoints * sizeof(Vector3));
+		std::vector<uint32_t> indices(par->triangles, par->triangles + count);
+		SetIndices(mesh, indices.data(), count);
+		mesh->normals.resize(par->npoints);
+		memcpy(mesh->normals.data(), par->normals, par->npoints * sizeof(Vector3));
+		par_shapes_free_mesh(par);
+	}
+	else
+	{
+		assert(shape == CUBE);
+		GenCube(mesh, 1.0f, 1.0f, 1.0f);
+	}
+	ComputeBounds(mesh);
+}
+
+void SetIndices(Mesh* mesh, const uint32_t* indices, int count)
+{
+	mesh->indices16.clear();
+	mesh->indices32.clear();
+	if (mesh->positions.size() <= UINT16_MAX + 1)
+	{
+		mesh->indices16.assign(indices, indices + count);
+		mesh->indexType = GL_UNSIGNED_SHORT;
+	}
+	else
+	{
+		mesh->indices32.assign(indices, indices + count);
+		mesh->indexType = GL_UNSIGNED_INT;
+	}
+}
+
+bool IsInFrustum(const Mesh& mesh, Affine world, const ViewFrustum& frustum)
+{
+	// The sphere test is cheaper and rejects most objects, the box is tighter for long thin meshes
+	return InFrustum(frustum, Transform(mesh.sphere, world)) && InFrustum(frustum, Transform(mesh.box, world));
+}
+
+MeshStreams GetStreams(const Mesh& mesh)
+{
+	MeshStreams streams;
+	streams.positions = mesh.positions.data();
+	streams.normals = mesh.normals.data();
+	streams.tcoords = mesh.tcoords.empty() ? nullptr : mesh.tcoords.data();
+	streams.vertexCount = (int)mesh.positions.size();
+	streams.indexType = mesh.indexType;
+	if (mesh.indexType == GL_UNSIGNED_SHORT)
+	{
+		streams.indices = mesh.indices16.data();
+		streams.indexCount = (int)mesh.indices16.size();
+	}
+	else if (mesh.indexType == GL_UNSIGNED_INT)
+	{
+		streams.indices = mesh.indices32.data();
+		streams.indexCount = (int)mesh.indices32.size();
+	}
+	return streams;
+}
+
+std::vector<Vertex> Interleave(const MeshStreams& streams)
+{
+	std::vector<Vertex> vertices(streams.vertexCount);
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		vertices[i].position = streams.positions[i];
+		vertices[i].normal = streams.normals[i];
+		vertices[i].tcoord = streams.tcoords == nullptr ? V2_ZERO : streams.tcoords[i];
+	}
+	return vertices;
+}
+
+// Unit cube (1x1x1), 4 vertices per face so each face gets its own normal and tcoords
+static constexpr Vector3 CUBE_POSITIONS[24] = {
+	{ -0.5f, -0.5f,  0.5f },
+	{  0.5f, -0.5f,  0.5f },
+	{  0.5f,  0.5f,  0.5f },
+	{ -0.5f,  0.5f,  0.5f },
+	{ -0.5f, -0.5f, -0.5f },
+	{ -0.5f,  0.5f, -0.5f },
+	{  0.5f,  0.5f, -0.5f },
+	{  0.5f, -0.5f, -0.5f },
+	{ -0.5f,  0.5f, -0.5f },
+	{ -0.5f,  0.5f,  0.5f },
+	{  0.5f,  0.5f,  0.5f },
+	{  0.5f,  0.5f, -0.5f },
+	{ -0.5f, -0.5f, -0.5f },
+	{  0.5f, -0.5f, -0.5f },
+	{  0.5f, -0.5f,  0.5f },
+	{ -0.5f, -0.5f,  0.5f },
+	{  0.5f, -0.5f, -0.5f },
+	{  0.5f,  0.5f, -0.5f },
+	{  0.5f,  0.5f,  0.5f },
+	{  0.5f, -0.5f,  0.5f },
+	{ -0.5f, -0.5f, -0.5f },
+	{ -0.5f, -0.5f,  0.5f },
+	{ -0.5f,  0.5f,  0.5f },
+	{ -0.5f,  0.5f, -0.5f }
+};
+
+static constexpr Vector2 CUBE_TCOORDS[24] = {
+	{ 0.0f, 0.0f },
+	{ 1.0f, 0.0f },
+	{ 1.0f, 1.0f },
+	{ 0.0f, 1.0f },
+	{ 1.0f, 0.0f },
+	{ 1.0f, 1.0f },
+	{ 0.0f, 1.0f },
+	{ 0.0f, 0.0f },
+	{ 0.0f, 1.0f },
+	{ 0.0f, 0.0f },
+	{ 1.0f, 0.0f },
+	{ 1.0f, 1.0f },
+	{ 1.0f, 1.0f },
+	{ 0.0f, 1.0f },
+	{ 0.0f, 0.0f },
+	{ 1.0f, 0.0f },
+	{ 1.0f, 0.0f },
+	{ 1.0f, 1.0f },
+	{ 0.0f, 1.0f },
+	{ 0.0f, 0.0f },
+	{ 0.0f, 0.0f },
+	{ 1.0f, 0.0f },
+	{ 1.0f, 1.0f },
+	{ 0.0f, 1.0f }
+};
+
+static constexpr Vector3 CUBE_NORMALS[24] = {
+	{  0.0f,  0.0f,  1.0f },
+	{  0.0f,  0.0f,  1.0f },
+	{  0.0f,  0.0f,  1.0f },
+	{  0.0f,  0.0f,  1.0f },
+	{  0.0f,  0.0f, -1.0f },
+	{  0.0f,  0.0f, -1.0f },
+	{  0.0f,  0.0f, -1.0f },
+	{  0.0f,  0.0f, -1.0f },
+	{  0.0f,  1.0f,  0.0f },
+	{  0.0f,  1.0f,  0.0f },
+	{  0.0f,  1.0f,  0.0f },
+	{  0.0f,  1.0f,  0.0f },
+	{  0.0f, -1.0f,  0.0f },
+	{  0.0f, -1.0f,  0.0f },
+	{  0.0f, -1.0f,  0.0f },
+	{  0.0f, -1.0f,  0.0f },
+	{  1.0f,  0.0f,  0.0f },
+	{  1.0f,  0.0f,  0.0f },
+	{  1.0f,  0.0f,  0.0f },
+	{  1.0f,  0.0f,  0.0f },
+	{ -1.0f,  0.0f,  0.0f },
+	{ -1.0f,  0.0f,  0.0f },
+	{ -1.0f,  0.0f,  0.0f },
+	{ -1.0f,  0.0f,  0.0f }
+};
+
+struct CubeIndices
+{
+	uint32_t v[36];
+};
+
+// Two triangles per face
+static constexpr CubeIndices GenCubeIndices()
+{
+	CubeIndices indices = {};
+	for (uint32_t face = 0; face < 6; face++)
+	{
+		indices.v[face * 6 + 0] = 4 * face;
+		indices.v[face * 6 + 1] = 4 * face + 1;
+		indices.v[face * 6 + 2] = 4 * face + 2;
+		indices.v[face * 6 + 3] = 4 * face;
+		indices.v[face * 6 + 4] = 4 * face + 2;
+		indices.v[face * 6 + 5] = 4 * face + 3;
+	}
+	return indices;
+}
+
+static constexpr CubeIndices CUBE_INDICES = GenCubeIndices();
+static_assert(CUBE_INDICES.v[35] == 23, "Last index must be the last vertex of the last face");
+
+static void GenCube(Mesh* mesh, float width, float height, float length)
+{
+	Vector3 size = { width, height, length };
+	mesh->positions.resize(24);
+	for (int i = 0; i < 24; i++)
+		mesh->positions[i] = CUBE_POSITIONS[i] * size;
+	mesh->normals.assign(CUBE_NORMALS, CUBE_NORMALS + 24);
+	mesh->tcoords.assign(CUBE_TCOORDS, CUBE_TCOORDS + 24);
+
+	SetIndices(mesh, CUBE_INDICES.v, 36);
+	mesh->count = 36;
+}
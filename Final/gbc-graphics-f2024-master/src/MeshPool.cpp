@@ -0,0 +1,102 @@
+#include "MeshPool.h"
+#include "State.h"
+#include <cstddef>
+#include <cstdio>
+
+void CreateMeshPool(MeshPool* pool, int vertexCapacity, int indexCapacity)
+{
+	pool->vertexCapacity = vertexCapacity;
+	pool->indexCapacity = indexCapacity;
+	pool->vertexCount = 0;
+	pool->indexCount = 0;
+
+	glCreateBuffers(1, &pool->vbo);
+	glNamedBufferStorage(pool->vbo, vertexCapacity * sizeof(Vertex), nullptr, GL_DYNAMIC_STORAGE_BIT);
+	glCreateBuffers(1, &pool->ebo);
+	glNamedBufferStorage(pool->ebo, indexCapacity * sizeof(uint32_t), nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+	// Same attribute locations as an INTERLEAVED Mesh, so pooled meshes work with the regular vertex shaders' inputs
+	glGenVertexArrays(1, &pool->vao);
+	BindVertexArray(pool->vao);
+	glBindVertexBuffer(0, pool->vbo, 0, sizeof(Vertex));
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, pool->ebo);
+
+	glVertexAttribFormat(0, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, position));
+	glVertexAttribBinding(0, 0);
+	glEnableVertexAttribArray(0);
+
+	glVertexAttribFormat(1, 3, GL_FLOAT, GL_FALSE, offsetof(Vertex, normal));
+	glVertexAttribBinding(1, 0);
+	glEnableVertexAttribArray(1);
+
+	glVertexAttribFormat(2, 2, GL_FLOAT, GL_FALSE, offsetof(Vertex, tcoord));
+	glVertexAttribBinding(2, 0);
+	glEnableVertexAttribArray(2);
+
+	BindVertexArray(GL_NONE);
+	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, GL_NONE);
+}
+
+void DestroyMeshPool(MeshPool* pool)
+{
+	// Deleting the bound vao unbinds it, so keep the state cache in sync
+	BindVertexArray(GL_NONE);
+	glDeleteVertexArrays(1, &pool->vao);
+	glDeleteBuffers(1, &pool->vbo);
+	glDeleteBuffers(1, &pool->ebo);
+
+	pool->vao = pool->vbo = pool->ebo = GL_NONE;
+	pool->vertexCount = pool->indexCount = 0;
+}
+
+PoolMesh AddMesh(MeshPool* pool, const Mesh& mesh)
+{
+	PoolMesh result;
+	int vertexCount = (int)mesh.positions.size();
+	int indexCount = mesh.count;
+
+	// Still loading
+	if (vertexCount == 0)
+		return result;
+
+	if (pool->vertexCount + vertexCount > pool->vertexCapacity || pool->indexCount + indexCount > pool->indexCapacity)
+	{
+		printf("**Warning: mesh pool is full, %i vertices and %i indices didn't fit**\n", vertexCount, indexCount);
+		return result;
+	}
+
+	std::vector<Vertex> vertices = Interleave(GetStreams(mesh));
+
+	// Every pooled mesh shares one index type, and unindexed meshes index their vertices in order.
+	// Indices stay relative to the mesh, baseVertex offsets them when drawing.
+	std::vector<uint32_t> indices(indexCount);
+	for (int i = 0; i < indexCount; i++)
+	{
+		if (mesh.indexType == GL_UNSIGNED_SHORT)
+			indices[i] = mesh.indices16[i];
+		else if (mesh.indexType == GL_UNSIGNED_INT)
+			indices[i] = mesh.indices32[i];
+		else
+			indices[i] = i;
+	}
+
+	glNamedBufferSubData(pool->vbo, pool->vertexCount * sizeof(Vertex), vertexCount * sizeof(Vertex), vertices.data());
+	glNamedBufferSubData(pool->ebo, pool->indexCount * sizeof(uint32_t), indexCount * sizeof(uint32_t), indices.data());
+
+	result.count = indexCount;
+	result.firstIndex = pool->indexCount;
+	result.baseVertex = pool->vertexCount;
+	pool->vertexCount += vertexCount;
+	pool->indexCount += indexCount;
+	return result;
+}
+
+void DrawMeshPool(const MeshPool& pool, GLintptr offset, int count)
+{
+	if (count <= 0)
+		return;
+
+	BindVertexArray(pool.vao);
+	glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (const void*)offset, count, 0);
+	CountDraw();
+}
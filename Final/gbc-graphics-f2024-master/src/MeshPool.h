@@ -0,0 +1,47 @@
+#pragma once
+#include <glad/glad.h>
+#include "Mesh.h"
+
+// Layout glMultiDrawElementsIndirect reads from GL_DRAW_INDIRECT_BUFFER
+struct DrawElementsIndirectCommand
+{
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+static_assert(sizeof(DrawElementsIndirectCommand) == 20, "DrawElementsIndirectCommand must match the GL layout");
+
+// Where a mesh lives in its pool. count is 0 if the mesh wasn't added.
+struct PoolMesh
+{
+	int count = 0;		// Number of indices
+	int firstIndex = 0;
+	int baseVertex = 0;
+};
+
+// Many meshes sub-allocated from one interleaved vertex buffer and one 32-bit index buffer behind a single vao,
+// so draws of different meshes can be issued together with one glMultiDrawElementsIndirect.
+struct MeshPool
+{
+	GLuint vao = GL_NONE;
+	GLuint vbo = GL_NONE;
+	GLuint ebo = GL_NONE;
+
+	int vertexCapacity = 0;
+	int indexCapacity = 0;
+	int vertexCount = 0;	// Vertices used so far
+	int indexCount = 0;		// Indices used so far
+};
+
+void CreateMeshPool(MeshPool* pool, int vertexCapacity, int indexCapacity);
+void DestroyMeshPool(MeshPool* pool);
+
+// Copies the mesh's CPU data into the pool. Meshes are never removed, the pool is destroyed as a whole.
+// Returns an empty PoolMesh if the mesh has no CPU data yet (still loading) or the pool is full.
+PoolMesh AddMesh(MeshPool* pool, const Mesh& mesh);
+
+// Issues count commands starting offset bytes into the bound GL_DRAW_INDIRECT_BUFFER as one draw call.
+// gl_DrawID runs from 0 to count - 1 (see default_multidraw.vert).
+void DrawMeshPool(const MeshPool& pool, GLintptr offset, int count);
@@ -0,0 +1,107 @@
+#include "Png.h"
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+static uint32_t Crc32(const uint8_t* data, size_t size, uint32_t crc = 0)
+{
+	static uint32_t table[256];
+	if (table[1] == 0)
+	{
+		for (uint32_t i = 0; i < 256; i++)
+		{
+			uint32_t c = i;
+			for (int k = 0; k < 8; k++)
+				c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+			table[i] = c;
+		}
+	}
+
+	crc = ~crc;
+	for (size_t i = 0; i < size; i++)
+		crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+static void PutU32(std::vector<uint8_t>& out, uint32_t value)
+{
+	out.push_back(value >> 24);
+	out.push_back(value >> 16);
+	out.push_back(value >> 8);
+	out.push_back(value);
+}
+
+static void WriteChunk(FILE* file, const char* type, const std::vector<uint8_t>& data)
+{
+	std::vector<uint8_t> chunk;
+	PutU32(chunk, (uint32_t)data.size());
+	chunk.insert(chunk.end(), type, type + 4);
+	chunk.insert(chunk.end(), data.begin(), data.end());
+	PutU32(chunk, Crc32(chunk.data() + 4, chunk.size() - 4));
+	fwrite(chunk.data(), 1, chunk.size(), file);
+}
+
+bool WritePng(const char* path, int width, int height, const uint8_t* rgba)
+{
+	FILE* file = fopen(path, "wb");
+	if (file == nullptr)
+	{
+		printf("Failed to write %s\n", path);
+		return false;
+	}
+
+	const uint8_t signature[8] = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n' };
+	fwrite(signature, 1, sizeof(signature), file);
+
+	std::vector<uint8_t> header;
+	PutU32(header, width);
+	PutU32(header, height);
+	header.push_back(8);	// Bits per channel
+	header.push_back(6);	// RGBA
+	header.push_back(0);	// Deflate
+	header.push_back(0);	// Adaptive filtering
+	header.push_back(0);	// Not interlaced
+	WriteChunk(file, "IHDR", header);
+
+	// Every row starts with its filter type (0 = none)
+	size_t stride = width * 4;
+	std::vector<uint8_t> raw;
+	raw.reserve((stride + 1) * height);
+	for (int y = 0; y < height; y++)
+	{
+		raw.push_back(0);
+		raw.insert(raw.end(), rgba + y * stride, rgba + (y + 1) * stride);
+	}
+
+	// zlib stream made of uncompressed deflate blocks, which hold at most 65535 bytes each.
+	// Larger than a compressed PNG, but we don't need a compressor to write it.
+	std::vector<uint8_t> zlib = { 0x78, 0x01 };
+	uint32_t a = 1, b = 0;
+	size_t offset = 0;
+	while (true)
+	{
+		size_t size = std::min(raw.size() - offset, (size_t)65535);
+		bool last = offset + size == raw.size();
+		zlib.push_back(last ? 1 : 0);
+		zlib.push_back(size & 0xFF);
+		zlib.push_back(size >> 8);
+		zlib.push_back(~size & 0xFF);
+		zlib.push_back((~size >> 8) & 0xFF);
+		zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + size);
+		for (size_t i = offset; i < offset + size; i++)
+		{
+			a = (a + raw[i]) % 65521;
+			b = (b + a) % 65521;
+		}
+		offset += size;
+		if (last)
+			break;
+	}
+	PutU32(zlib, (b << 16) | a);	// Adler-32
+	WriteChunk(file, "IDAT", zlib);
+	WriteChunk(file, "IEND", {});
+
+	bool success = ferror(file) == 0;
+	success &= fclose(file) == 0;
+	return success;
+}
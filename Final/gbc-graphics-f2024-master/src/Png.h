@@ -0,0 +1,6 @@
+#pragma once
+#include <cstdint>
+
+// Writes an uncompressed 8-bit RGBA PNG. Rows are top to bottom.
+// Doesn't touch OpenGL, so the software rasterizer can save frames too.
+bool WritePng(const char* path, int width, int height, const uint8_t* rgba);
@@ -0,0 +1,191 @@
+#include "Profiler.h"
+#include "State.h"
+#include "imgui/imgui.h"
+#include <cassert>
+
+static const char* PASS_NAMES[PASS_COUNT] =
+{
+	"Skybox",
+	"Lit sphere",
+	"Tcoord/normal spheres",
+	"Light gizmos",
+	"Refract",
+	"Reflect",
+	"Instanced spheres",
+	"ImGui"
+};
+
+void CreateProfiler(Profiler* profiler)
+{
+	glGenQueries(PROFILER_LATENCY * PASS_COUNT, &profiler->queries[0][0]);
+}
+
+void DestroyProfiler(Profiler* profiler)
+{
+	glDeleteQueries(PROFILER_LATENCY * PASS_COUNT, &profiler->queries[0][0]);
+	*profiler = Profiler{};
+}
+
+void BeginFrame(Profiler* profiler)
+{
+	assert(profiler->pass == PASS_COUNT);
+	profiler->frame++;
+	profiler->head = profiler->frame % PROFILER_HISTORY;
+
+	// This frame's query set was last used PROFILER_LATENCY frames ago, so its results should be ready.
+	// If the GPU is further behind than that, drop the sample rather than stall.
+	int set = profiler->frame % PROFILER_LATENCY;
+	for (int i = 0; i < PASS_COUNT; i++)
+	{
+		profiler->cpu[i][profiler->head] = 0.0f;
+		profiler->gpu[i][profiler->head] = 0.0f;
+		profiler->gpuValid[i][profiler->head] = true;
+		profiler->drawCalls[i] = 0;
+		profiler->stateChanges[i] = 0;
+		profiler->skippedStateChanges[i] = 0;
+		profiler->visibleObjects[i] = 0;
+		profiler->culledObjects[i] = 0;
+		if (!profiler->issued[set][i])
+			continue;
+
+		GLuint query = profiler->queries[set][i];
+		GLint available = GL_FALSE;
+		glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (available)
+		{
+			GLuint64 ns = 0;
+			glGetQueryObjectui64v(query, GL_QUERY_RESULT, &ns);
+			profiler->gpu[i][profiler->head] = ns / 1000000.0f;
+		}
+		profiler->gpuValid[i][profiler->head] = available;
+		profiler->issued[set][i] = false;
+	}
+
+	gRenderStats = RenderStats{};
+}
+
+void BeginPass(Profiler* profiler, ProfilePass pass)
+{
+	assert(profiler->pass == PASS_COUNT);
+	profiler->pass = pass;
+
+	// The timer can only run once per pass per frame, so a repeated pass only adds its CPU time and counts
+	int set = profiler->frame % PROFILER_LATENCY;
+	if (!profiler->issued[set][pass])
+		glBeginQuery(GL_TIME_ELAPSED, profiler->queries[set][pass]);
+
+	profiler->startDrawCalls = gRenderStats.drawCalls;
+	profiler->startStateChanges = gRenderStats.stateChanges;
+	profiler->startSkippedStateChanges = gRenderStats.skippedStateChanges;
+	profiler->start = std::chrono::steady_clock::now();
+}
+
+void EndPass(Profiler* profiler)
+{
+	ProfilePass pass = profiler->pass;
+	assert(pass != PASS_COUNT);
+
+	float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - profiler->start).count();
+	profiler->cpu[pass][profiler->head] += ms;
+	profiler->drawCalls[pass] += gRenderStats.drawCalls - profiler->startDrawCalls;
+	profiler->stateChanges[pass] += gRenderStats.stateChanges - profiler->startStateChanges;
+	profiler->skippedStateChanges[pass] += gRenderStats.skippedStateChanges - profiler->startSkippedStateChanges;
+
+	int set = profiler->frame % PROFILER_LATENCY;
+	if (!profiler->issued[set][pass])
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		profiler->issued[set][pass] = true;
+	}
+	profiler->pass = PASS_COUNT;
+}
+
+// Dropped samples (valid[i] == false) are left out rather than averaged in as 0
+static float Average(const float* history, const bool* valid = nullptr)
+{
+	float sum = 0.0f;
+	int count = 0;
+	for (int i = 0; i < PROFILER_HISTORY; i++)
+	{
+		if (valid != nullptr && !valid[i])
+			continue;
+		sum += history[i];
+		count++;
+	}
+	return count > 0 ? sum / count : 0.0f;
+}
+
+void DrawProfiler(const Profiler& profiler)
+{
+	if (!ImGui::Begin("Profiler"))
+	{
+		ImGui::End();
+		return;
+	}
+
+	// Frame totals, oldest sample first. A GPU total is only valid if none of its passes were dropped,
+	// and the plot repeats the last valid total instead of dipping to 0.
+	float cpuTotal[PROFILER_HISTORY]{};
+	float gpuTotal[PROFILER_HISTORY]{};
+	bool gpuTotalValid[PROFILER_HISTORY]{};
+	for (int i = 0; i < PROFILER_HISTORY; i++)
+	{
+		int sample = (profiler.head + 1 + i) % PROFILER_HISTORY;
+		gpuTotalValid[i] = true;
+		for (int j = 0; j < PASS_COUNT; j++)
+		{
+			cpuTotal[i] += profiler.cpu[j][sample];
+			gpuTotal[i] += profiler.gpu[j][sample];
+			gpuTotalValid[i] &= profiler.gpuValid[j][sample];
+		}
+		if (!gpuTotalValid[i])
+			gpuTotal[i] = i > 0 ? gpuTotal[i - 1] : 0.0f;
+	}
+	ImGui::PlotLines("CPU ms", cpuTotal, PROFILER_HISTORY, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f));
+	ImGui::PlotLines("GPU ms", gpuTotal, PROFILER_HISTORY, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0.0f, 40.0f));
+
+	if (ImGui::BeginTable("Passes", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+	{
+		ImGui::TableSetupColumn("Pass");
+		ImGui::TableSetupColumn("CPU ms");
+		ImGui::TableSetupColumn("GPU ms");
+		ImGui::TableSetupColumn("Draws");
+		ImGui::TableSetupColumn("State changes");
+		ImGui::TableSetupColumn("Skipped");
+		ImGui::TableSetupColumn("Visible");
+		ImGui::TableSetupColumn("Culled");
+		ImGui::TableHeadersRow();
+
+		int drawCalls = 0, stateChanges = 0, skippedStateChanges = 0, visibleObjects = 0, culledObjects = 0;
+		for (int i = 0; i < PASS_COUNT; i++)
+		{
+			drawCalls += profiler.drawCalls[i];
+			stateChanges += profiler.stateChanges[i];
+			skippedStateChanges += profiler.skippedStateChanges[i];
+			visibleObjects += profiler.visibleObjects[i];
+			culledObjects += profiler.culledObjects[i];
+
+			ImGui::TableNextRow();
+			ImGui::TableNextColumn(); ImGui::TextUnformatted(PASS_NAMES[i]);
+			ImGui::TableNextColumn(); ImGui::Text("%.3f", Average(profiler.cpu[i]));
+			ImGui::TableNextColumn(); ImGui::Text("%.3f", Average(profiler.gpu[i], profiler.gpuValid[i]));
+			ImGui::TableNextColumn(); ImGui::Text("%i", profiler.drawCalls[i]);
+			ImGui::TableNextColumn(); ImGui::Text("%i", profiler.stateChanges[i]);
+			ImGui::TableNextColumn(); ImGui::Text("%i", profiler.skippedStateChanges[i]);
+			ImGui::TableNextColumn(); ImGui::Text("%i", profiler.visibleObjects[i]);
+			ImGui::TableNextColumn(); ImGui::Text("%i", profiler.culledObjects[i]);
+		}
+
+		ImGui::TableNextRow();
+		ImGui::TableNextColumn(); ImGui::TextUnformatted("Total");
+		ImGui::TableNextColumn(); ImGui::Text("%.3f", Average(cpuTotal));
+		ImGui::TableNextColumn(); ImGui::Text("%.3f", Average(gpuTotal, gpuTotalValid));
+		ImGui::TableNextColumn(); ImGui::Text("%i", drawCalls);
+		ImGui::TableNextColumn(); ImGui::Text("%i", stateChanges);
+		ImGui::TableNextColumn(); ImGui::Text("%i", skippedStateChanges);
+		ImGui::TableNextColumn(); ImGui::Text("%i", visibleObjects);
+		ImGui::TableNextColumn(); ImGui::Text("%i", culledObjects);
+		ImGui::EndTable();
+	}
+	ImGui::End();
+}
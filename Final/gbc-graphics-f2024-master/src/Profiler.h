@@ -0,0 +1,63 @@
+#pragma once
+#include <glad/glad.h>
+#include <chrono>
+
+enum ProfilePass : int
+{
+	PASS_SKYBOX,
+	PASS_LIT,		// Textured sphere lit by the point and spot lights
+	PASS_DEBUG,		// Tcoord and normal spheres
+	PASS_GIZMOS,	// Light outlines
+	PASS_REFRACT,
+	PASS_REFLECT,
+	PASS_INSTANCED,	// Object 3's sphere grid
+	PASS_IMGUI,
+	PASS_COUNT
+};
+
+constexpr int PROFILER_HISTORY = 120;	// Frames of history shown in the overlay
+
+// GPU queries are read back this many frames after they were issued so we never wait on the GPU
+constexpr int PROFILER_LATENCY = 2;
+
+struct Profiler
+{
+	// Timer queries, one set per frame in flight
+	GLuint queries[PROFILER_LATENCY][PASS_COUNT]{};
+	bool issued[PROFILER_LATENCY][PASS_COUNT]{};
+
+	// Milliseconds per pass, stored in a ring buffer
+	float cpu[PASS_COUNT][PROFILER_HISTORY]{};
+	float gpu[PASS_COUNT][PROFILER_HISTORY]{};
+	bool gpuValid[PASS_COUNT][PROFILER_HISTORY]{};	// False where the query wasn't ready and the sample was dropped
+	int head = 0;
+
+	// Counts from the most recent frame
+	int drawCalls[PASS_COUNT]{};
+	int stateChanges[PASS_COUNT]{};
+	int skippedStateChanges[PASS_COUNT]{};
+	int visibleObjects[PASS_COUNT]{};	// Added by Flush, see IsVisible in RenderQueue.h
+	int culledObjects[PASS_COUNT]{};
+
+	// Pass being recorded
+	ProfilePass pass = PASS_COUNT;
+	std::chrono::steady_clock::time_point start;
+	int startDrawCalls = 0;
+	int startStateChanges = 0;
+	int startSkippedStateChanges = 0;
+
+	int frame = 0;
+};
+
+void CreateProfiler(Profiler* profiler);
+void DestroyProfiler(Profiler* profiler);
+
+// Call once per frame before any pass. Reads back the queries from PROFILER_LATENCY frames ago.
+void BeginFrame(Profiler* profiler);
+
+// Passes can't nest. A pass that isn't recorded during a frame shows as 0.
+void BeginPass(Profiler* profiler, ProfilePass pass);
+void EndPass(Profiler* profiler);
+
+// ImGui window with per-pass CPU/GPU ms, draw calls, state changes (made and skipped) and visible/culled objects
+void DrawProfiler(const Profiler& profiler);
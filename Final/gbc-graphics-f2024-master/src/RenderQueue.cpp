@@ -0,0 +1,312 @@
+#include "RenderQueue.h"
+#include "State.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+uint64_t MakeSortKey(ProfilePass pass, GLuint program, GLuint texture, float depth)
+{
+	uint32_t depthBits = 0;
+	depth = fmaxf(depth, 0.0f);
+	memcpy(&depthBits, &depth, sizeof(depthBits));
+
+	return ((uint64_t)(pass & 0xF) << 60) |
+		((uint64_t)(program & 0xFFF) << 48) |
+		((uint64_t)(texture & 0xFFFF) << 32) |
+		depthBits;
+}
+
+void CreateRenderQueue(RenderQueue* queue, RingBuffer* ring)
+{
+	queue->ring = ring;
+}
+
+bool IsVisible(RenderQueue* queue, ProfilePass pass, const Mesh& mesh, Affine world, const ViewFrustum& frustum)
+{
+	if (mesh.count == 0)
+		return false;
+
+	bool visible = IsVisible(mesh, world, frustum);
+	if (visible)
+		queue->visibleObjects[pass]++;
+	else
+		queue->culledObjects[pass]++;
+	return visible;
+}
+
+void Submit(RenderQueue* queue, ProfilePass pass, const Program& program, const Mesh& mesh, float depth, RenderState state)
+{
+	DrawItem item;
+	item.pass = pass;
+	item.program = &program;
+	item.mesh = &mesh;
+	item.state = state;
+	item.depth = depth;
+	item.firstUniform = (int)queue->uniforms.size();
+	queue->items.push_back(item);
+}
+
+void SubmitInstanced(RenderQueue* queue, ProfilePass pass, const Program& program, const Mesh& mesh,
+	const InstanceData* instances, int count, float depth, RenderState state)
+{
+	int first = (int)queue->instances.size();
+	Submit(queue, pass, program, mesh, depth, state);
+	queue->items.back().firstInstance = first;
+	queue->items.back().instanceCount = count;
+	queue->instances.insert(queue->instances.end(), instances, instances + count);
+}
+
+void SubmitPooled(RenderQueue* queue, ProfilePass pass, const Program& program, const MeshPool& pool, PoolMesh mesh,
+	const InstanceData& draw, float depth, RenderState state)
+{
+	DrawItem item;
+	item.pass = pass;
+	item.program = &program;
+	item.pool = &pool;
+	item.poolMesh = mesh;
+	item.draw = (int)queue->draws.size();
+	item.state = state;
+	item.depth = depth;
+	item.firstUniform = (int)queue->uniforms.size();
+	queue->items.push_back(item);
+	queue->draws.push_back(draw);
+}
+
+void SetTexture(RenderQueue* queue, int unit, GLenum target, GLuint texture)
+{
+	assert(!queue->items.empty() && unit >= 0 && unit < MAX_DRAW_TEXTURES);
+	queue->items.back().textures[unit] = { target, texture };
+}
+
+// Appends a uniform to the most recent draw
+static UniformValue* AddUniform(RenderQueue* queue, const char* name, GLenum type)
+{
+	assert(!queue->items.empty());
+	queue->items.back().uniformCount++;
+
+	UniformValue value;
+	value.hash = Hash(name);
+	value.type = type;
+	queue->uniforms.push_back(value);
+	return &queue->uniforms.back();
+}
+
+void SendInt(RenderQueue* queue, const char* name, int value)
+{
+	AddUniform(queue, name, GL_INT)->i = value;
+}
+
+void SendFloat(RenderQueue* queue, const char* name, float value)
+{
+	AddUniform(queue, name, GL_FLOAT)->v[0] = value;
+}
+
+void SendVec3(RenderQueue* queue, const char* name, Vector3 value)
+{
+	memcpy(AddUniform(queue, name, GL_FLOAT_VEC3)->v, ToFloat3(value).v, sizeof(float3));
+}
+
+void SendMat3(RenderQueue* queue, const char* name, Matrix value)
+{
+	memcpy(AddUniform(queue, name, GL_FLOAT_MAT3)->v, ToFloat9(value).v, sizeof(float9));
+}
+
+void SendMat3(RenderQueue* queue, const char* name, Affine value)
+{
+	SendMat3(queue, name, ToMatrix(value));
+}
+
+void SendMat4(RenderQueue* queue, const char* name, Matrix value)
+{
+	memcpy(AddUniform(queue, name, GL_FLOAT_MAT4)->v, ToFloat16(value).v, sizeof(float16));
+}
+
+void SendMat4(RenderQueue* queue, const char* name, Affine value)
+{
+	SendMat4(queue, name, ToMatrix(value));
+}
+
+// Whether b can join the multi-draw a started. Both must be pooled draws.
+static bool CanBatch(const DrawItem& a, const DrawItem& b)
+{
+	if (b.pool != a.pool || b.command < 0 || b.pass != a.pass || b.program != a.program || b.uniformCount > 0)
+		return false;
+	if (b.state.polygonMode != a.state.polygonMode || b.state.depthWrite != a.state.depthWrite)
+		return false;
+	for (int unit = 0; unit < MAX_DRAW_TEXTURES; unit++)
+	{
+		if (b.textures[unit].target != a.textures[unit].target || b.textures[unit].id != a.textures[unit].id)
+			return false;
+	}
+	return true;
+}
+
+static void ApplyUniform(const Program& program, const UniformValue& value)
+{
+	GLint location = GetUniform(program, value.hash);
+	switch (value.type)
+	{
+	case GL_INT:
+		glUniform1i(location, value.i);
+		break;
+
+	case GL_FLOAT:
+		glUniform1f(location, value.v[0]);
+		break;
+
+	case GL_FLOAT_VEC3:
+		glUniform3fv(location, 1, value.v);
+		break;
+
+	case GL_FLOAT_MAT3:
+		glUniformMatrix3fv(location, 1, GL_FALSE, value.v);
+		break;
+
+	case GL_FLOAT_MAT4:
+		glUniformMatrix4fv(location, 1, GL_FALSE, value.v);
+		break;
+
+	default:
+		assert(false);
+		break;
+	}
+}
+
+void Flush(RenderQueue* queue, Profiler* profiler)
+{
+	std::vector<DrawItem>& items = queue->items;
+	std::vector<int>& order = queue->order;
+
+	int count = (int)items.size();
+	order.resize(count);
+	for (int i = 0; i < count; i++)
+	{
+		DrawItem& item = items[i];
+		item.key = MakeSortKey(item.pass, item.program->id, item.textures[0].id, item.depth);
+		order[i] = i;
+	}
+
+	// Stable so equal keys keep their submission order and frames are deterministic
+	std::stable_sort(order.begin(), order.end(), [&items](int a, int b) { return items[a].key < items[b].key; });
+
+	// One upload for every instanced draw, each draws its own range via its base instance
+	bool instancesUploaded = false;
+	if (!queue->instances.empty())
+	{
+		RingAllocation instances = Push(queue->ring, queue->instances.data(), queue->instances.size() * sizeof(InstanceData));
+		if (instances.data != nullptr)
+		{
+			BindRange(*queue->ring, instances, GL_SHADER_STORAGE_BUFFER, INSTANCE_BINDING);
+			instancesUploaded = true;
+		}
+	}
+
+	// Pooled draws get their commands in sorted order, so every run of them that can be batched is one range
+	std::vector<DrawElementsIndirectCommand>& commands = queue->commands;
+	std::vector<InstanceData>& commandDraws = queue->commandDraws;
+	for (int index : order)
+	{
+		DrawItem& item = items[index];
+		if (item.pool == nullptr || item.poolMesh.count == 0)
+			continue;
+
+		item.command = (int)commands.size();
+		commands.push_back({ (GLuint)item.poolMesh.count, 1, (GLuint)item.poolMesh.firstIndex, item.poolMesh.baseVertex, 0 });
+		commandDraws.push_back(queue->draws[item.draw]);
+	}
+	RingAllocation commandRange;
+	if (!commands.empty())
+	{
+		commandRange = Push(queue->ring, commands.data(), commands.size() * sizeof(DrawElementsIndirectCommand));
+		RingAllocation drawRange = Push(queue->ring, commandDraws.data(), commandDraws.size() * sizeof(InstanceData));
+		if (commandRange.data != nullptr && drawRange.data != nullptr)
+		{
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, queue->ring->buffer);
+			BindRange(*queue->ring, drawRange, GL_SHADER_STORAGE_BUFFER, DRAW_BINDING);
+		}
+		else
+		{
+			// Didn't fit, so pooled draws are skipped this frame
+			for (DrawItem& item : items)
+				item.command = -1;
+		}
+	}
+
+	// The state wrappers skip whatever the previous draw already set, so sorted draws mostly set nothing
+	ProfilePass pass = PASS_COUNT;
+	for (int i = 0; i < count; i++)
+	{
+		const DrawItem& item = items[order[i]];
+
+		// Still loading, or its data didn't fit in the ring
+		if (item.pool != nullptr ? item.command < 0 : item.mesh->vao == GL_NONE)
+			continue;
+		if (item.instanceCount > 0 && !instancesUploaded)
+			continue;
+
+		if (item.pass != pass)
+		{
+			if (pass != PASS_COUNT)
+				EndPass(profiler);
+			BeginPass(profiler, item.pass);
+			pass = item.pass;
+		}
+
+		UseProgram(item.program->id);
+		for (int unit = 0; unit < MAX_DRAW_TEXTURES; unit++)
+		{
+			TextureBinding texture = item.textures[unit];
+			if (texture.target == GL_NONE)
+				continue;
+
+			ActiveTexture(GL_TEXTURE0 + unit);
+			BindTexture(texture.target, texture.id);
+		}
+		SetPolygonMode(item.state.polygonMode);
+		SetDepthMask(item.state.depthWrite);
+
+		// Uniforms are program state, so they still have to be sent for every draw
+		for (int u = item.firstUniform; u < item.firstUniform + item.uniformCount; u++)
+			ApplyUniform(*item.program, queue->uniforms[u]);
+
+		if (item.pool != nullptr)
+		{
+			// Every following draw that only differs by mesh and draw data joins this multi-draw
+			int batch = 1;
+			while (i + batch < count && CanBatch(item, items[order[i + batch]]))
+				batch++;
+
+			glUniform1i(GetUniform(*item.program, Hash("u_firstDraw")), item.command);
+			DrawMeshPool(*item.pool, commandRange.offset + item.command * sizeof(DrawElementsIndirectCommand), batch);
+			i += batch - 1;
+		}
+		else if (item.instanceCount > 0)
+			DrawMeshInstanced(*item.mesh, item.instanceCount, item.firstInstance);
+		else
+			DrawMesh(*item.mesh);
+	}
+
+	if (pass != PASS_COUNT)
+		EndPass(profiler);
+
+	// Leave the defaults for whatever renders next
+	RenderState defaults;
+	SetPolygonMode(defaults.polygonMode);
+	SetDepthMask(defaults.depthWrite);
+	ActiveTexture(GL_TEXTURE0);
+
+	for (int i = 0; i < PASS_COUNT; i++)
+	{
+		profiler->visibleObjects[i] += queue->visibleObjects[i];
+		profiler->culledObjects[i] += queue->culledObjects[i];
+		queue->visibleObjects[i] = 0;
+		queue->culledObjects[i] = 0;
+	}
+
+	items.clear();
+	queue->uniforms.clear();
+	queue->instances.clear();
+	queue->draws.clear();
+	commands.clear();
+	commandDraws.clear();
+}
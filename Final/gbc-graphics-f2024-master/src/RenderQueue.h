@@ -0,0 +1,125 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+#include "Math.h"
+#include "Mesh.h"
+#include "MeshPool.h"
+#include "Profiler.h"
+#include "RingBuffer.h"
+#include "Shader.h"
+
+constexpr int MAX_DRAW_TEXTURES = 2;	// Texture units a queued draw can bind
+
+struct TextureBinding
+{
+	GLenum target = GL_NONE;	// GL_TEXTURE_2D, GL_TEXTURE_CUBE_MAP, or GL_NONE if the draw doesn't use the unit
+	GLuint id = GL_NONE;
+};
+
+// Fixed-function state a draw needs. Flush restores these defaults when it's done.
+struct RenderState
+{
+	GLenum polygonMode = GL_FILL;
+	bool depthWrite = true;
+};
+
+// Value of one uniform for one draw, applied by type when the draw is issued
+struct UniformValue
+{
+	uint32_t hash;
+	GLenum type;	// GL_INT, GL_FLOAT, GL_FLOAT_VEC3, GL_FLOAT_MAT3 or GL_FLOAT_MAT4
+	union
+	{
+		int i;
+		float v[16];	// float, vec3, or column-major mat3/mat4
+	};
+};
+
+struct DrawItem
+{
+	uint64_t key = 0;	// Filled by Flush, see MakeSortKey
+	ProfilePass pass = PASS_COUNT;
+	const Program* program = nullptr;
+	const Mesh* mesh = nullptr;	// nullptr for pooled draws
+	TextureBinding textures[MAX_DRAW_TEXTURES];	// Index = texture unit
+	RenderState state;
+	float depth = 0.0f;
+
+	// Range in RenderQueue::uniforms
+	int firstUniform = 0;
+	int uniformCount = 0;
+
+	// Range in RenderQueue::instances, or 0 instances for a regular draw
+	int firstInstance = 0;
+	int instanceCount = 0;
+
+	// Pooled draws only, see SubmitPooled
+	const MeshPool* pool = nullptr;
+	PoolMesh poolMesh;
+	int draw = 0;		// Index in RenderQueue::draws
+	int command = -1;	// Filled by Flush, index in RenderQueue::commands
+};
+
+// Draws recorded during a frame, issued sorted by Flush. Storage is reused, so steady-state frames don't allocate.
+struct RenderQueue
+{
+	std::vector<DrawItem> items;
+	std::vector<UniformValue> uniforms;
+	std::vector<InstanceData> instances;
+	std::vector<int> order;	// Indices into items, sorted by key
+
+	// Pooled draws' data in submission order, then their commands and data in sorted order.
+	// The sorted arrays are uploaded once per Flush, so each batch of pooled draws is one range of both.
+	std::vector<InstanceData> draws;
+	std::vector<DrawElementsIndirectCommand> commands;
+	std::vector<InstanceData> commandDraws;
+
+	// Flush writes instances (INSTANCE_BINDING), pooled draw data (DRAW_BINDING) and indirect commands here
+	RingBuffer* ring = nullptr;
+
+	// Cull results per pass since the last Flush. Culling happens before any pass is open, so Flush hands these to the profiler.
+	int visibleObjects[PASS_COUNT]{};
+	int culledObjects[PASS_COUNT]{};
+};
+
+// The ring must outlive the queue
+void CreateRenderQueue(RenderQueue* queue, RingBuffer* ring);
+
+// Packed so one integer compare sorts by pass, then program, then the texture on unit 0, then front-to-back.
+// Ids wider than their fields only make the sort less effective, state is still compared in full.
+// [63-60] pass | [59-48] program | [47-32] texture | [31-0] depth (non-negative floats sort like their bits)
+uint64_t MakeSortKey(ProfilePass pass, GLuint program, GLuint texture, float depth);
+
+// IsVisible that also counts the result against pass. Meshes still loading return false uncounted.
+bool IsVisible(RenderQueue* queue, ProfilePass pass, const Mesh& mesh, Affine world, const ViewFrustum& frustum);
+
+// Records a draw. depth is the distance from the camera, used to draw front-to-back within a program and texture.
+// Textures and uniforms set before the next Submit belong to this draw.
+void Submit(RenderQueue* queue, ProfilePass pass, const Program& program, const Mesh& mesh, float depth, RenderState state = {});
+void SetTexture(RenderQueue* queue, int unit, GLenum target, GLuint texture);
+
+// Records count copies of mesh drawn with a single call. The program must read its per-instance data
+// from INSTANCE_BINDING (ie default_instanced.vert). Uniforms and textures are shared by every copy.
+void SubmitInstanced(RenderQueue* queue, ProfilePass pass, const Program& program, const Mesh& mesh,
+	const InstanceData* instances, int count, float depth, RenderState state = {});
+
+// Records a draw of a mesh from a pool, with its data read from DRAW_BINDING at u_firstDraw + gl_DrawID
+// (ie default_multidraw.vert). Consecutive pooled draws from the same pool with the same program, textures
+// and state are issued as one multi-draw. Uniforms are shared by the whole multi-draw, so a pooled draw
+// with uniforms starts a new one.
+void SubmitPooled(RenderQueue* queue, ProfilePass pass, const Program& program, const MeshPool& pool, PoolMesh mesh,
+	const InstanceData& draw, float depth, RenderState state = {});
+
+// Same as the Program setters, but stored with the most recent draw
+void SendInt(RenderQueue* queue, const char* name, int value);
+void SendFloat(RenderQueue* queue, const char* name, float value);
+void SendVec3(RenderQueue* queue, const char* name, Vector3 value);
+void SendMat3(RenderQueue* queue, const char* name, Matrix value);	// Upper-left 3x3 of value
+void SendMat3(RenderQueue* queue, const char* name, Affine value);
+void SendMat4(RenderQueue* queue, const char* name, Matrix value);
+void SendMat4(RenderQueue* queue, const char* name, Affine value);
+
+// Sorts and issues every draw through the state wrappers, which skip whatever the previous draw already set.
+// Begins and ends a profiler pass whenever the pass changes, adds the cull counts to each pass, then empties the queue.
+void Flush(RenderQueue* queue, Profiler* profiler);
@@ -0,0 +1,89 @@
+#include "RingBuffer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+void CreateRingBuffer(RingBuffer* ring, GLsizeiptr frameSize)
+{
+	GLint uniformAlignment = 0, storageAlignment = 0;
+	glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &uniformAlignment);
+	glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &storageAlignment);
+	ring->alignment = std::max<GLsizeiptr>({ uniformAlignment, storageAlignment, 16 });
+
+	// Regions start aligned too
+	ring->frameSize = (frameSize + ring->alignment - 1) / ring->alignment * ring->alignment;
+	ring->offset = 0;
+	ring->frame = 0;
+
+	// Coherent, so writes are visible to the GPU without flushing
+	GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+	glCreateBuffers(1, &ring->buffer);
+	glNamedBufferStorage(ring->buffer, ring->frameSize * RING_FRAMES, nullptr, flags);
+	ring->data = (uint8_t*)glMapNamedBufferRange(ring->buffer, 0, ring->frameSize * RING_FRAMES, flags);
+}
+
+void DestroyRingBuffer(RingBuffer* ring)
+{
+	for (GLsync& fence : ring->fences)
+	{
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+
+	glUnmapNamedBuffer(ring->buffer);
+	glDeleteBuffers(1, &ring->buffer);
+	ring->buffer = GL_NONE;
+	ring->data = nullptr;
+}
+
+void BeginRingFrame(RingBuffer* ring)
+{
+	ring->frame = (ring->frame + 1) % RING_FRAMES;
+	ring->offset = 0;
+
+	GLsync& fence = ring->fences[ring->frame];
+	if (fence == nullptr)
+		return;
+
+	// Usually signaled already. Flush on the first wait in case the fence hasn't been submitted yet.
+	GLbitfield flags = GL_SYNC_FLUSH_COMMANDS_BIT;
+	while (glClientWaitSync(fence, flags, 1000000) == GL_TIMEOUT_EXPIRED)
+		flags = 0;
+	glDeleteSync(fence);
+	fence = nullptr;
+}
+
+void EndRingFrame(RingBuffer* ring)
+{
+	ring->fences[ring->frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+RingAllocation Allocate(RingBuffer* ring, GLsizeiptr size)
+{
+	RingAllocation allocation;
+	GLsizeiptr start = (ring->offset + ring->alignment - 1) / ring->alignment * ring->alignment;
+	if (start + size > ring->frameSize)
+	{
+		printf("**Warning: ring buffer region is full, %i bytes didn't fit**\n", (int)size);
+		return allocation;
+	}
+
+	allocation.offset = ring->frame * ring->frameSize + start;
+	allocation.data = ring->data + allocation.offset;
+	allocation.size = size;
+	ring->offset = start + size;
+	return allocation;
+}
+
+RingAllocation Push(RingBuffer* ring, const void* data, GLsizeiptr size)
+{
+	RingAllocation allocation = Allocate(ring, size);
+	if (allocation.data != nullptr)
+		memcpy(allocation.data, data, size);
+	return allocation;
+}
+
+void BindRange(const RingBuffer& ring, const RingAllocation& allocation, GLenum target, GLuint binding)
+{
+	glBindBufferRange(target, binding, ring.buffer, allocation.offset, allocation.size);
+}
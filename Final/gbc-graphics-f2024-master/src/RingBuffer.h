@@ -0,0 +1,49 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+
+// Frames the CPU can write ahead of the GPU. Each gets its own region of the ring.
+constexpr int RING_FRAMES = 3;
+
+// Persistently mapped buffer for data rewritten every frame (uniforms, instances, indirect commands, vertices).
+// Allocations are bump-allocated from the current frame's region and written straight through the mapping,
+// so there's no glBufferSubData copy and no implicit sync. A fence per region makes sure the GPU is done
+// reading a region before the CPU writes it again.
+struct RingBuffer
+{
+	GLuint buffer = GL_NONE;
+	uint8_t* data = nullptr;	// Mapped for the buffer's lifetime
+
+	GLsizeiptr frameSize = 0;	// Bytes per region
+	GLsizeiptr alignment = 0;	// Every allocation starts on this, so it can be bound as a uniform or storage range
+	GLsizeiptr offset = 0;		// Next free byte in the current region
+
+	int frame = 0;	// Current region
+	GLsync fences[RING_FRAMES]{};
+};
+
+// Part of the current frame's region. offset is from the start of the buffer.
+struct RingAllocation
+{
+	void* data = nullptr;	// nullptr if the region is full
+	GLintptr offset = 0;
+	GLsizeiptr size = 0;
+};
+
+void CreateRingBuffer(RingBuffer* ring, GLsizeiptr frameSize);
+void DestroyRingBuffer(RingBuffer* ring);
+
+// Moves to the next region, waiting for the GPU if it's still reading it (RING_FRAMES frames ago)
+void BeginRingFrame(RingBuffer* ring);
+
+// Fences the current region. Call after every draw that reads this frame's allocations has been issued.
+void EndRingFrame(RingBuffer* ring);
+
+// Valid until the region comes around again, ie for the rest of this frame
+RingAllocation Allocate(RingBuffer* ring, GLsizeiptr size);
+
+// Allocates and copies in one step
+RingAllocation Push(RingBuffer* ring, const void* data, GLsizeiptr size);
+
+// Binds the allocation to an indexed target (GL_UNIFORM_BUFFER or GL_SHADER_STORAGE_BUFFER)
+void BindRange(const RingBuffer& ring, const RingAllocation& allocation, GLenum target, GLuint binding);
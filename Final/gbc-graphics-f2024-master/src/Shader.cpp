@@ -0,0 +1,240 @@
+#include "Shader.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+static void ReflectUniforms(Program* program);
+
+// Declared once here and prepended to every shader, so the shaders can't drift apart.
+// Must match Light and FrameData in Shader.h.
+static const char* FRAME_DATA_GLSL = R"(
+struct Light
+{
+    vec4 position;
+    vec4 color;
+    vec4 direction;
+    float radius;
+};
+
+layout (std140, binding = 0) uniform FrameData
+{
+    mat4 u_view;
+    mat4 u_proj;
+    mat4 u_viewProj;
+    vec4 u_cameraPosition;
+    Light u_lights[2]; // [0] = point light, [1] = spot light
+};
+)";
+
+GLuint CreateShader(GLint type, const char* path)
+{
+	GLuint shader = GL_NONE;
+	try
+	{
+		// Load text file
+		std::ifstream file;
+		file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+		file.open(path);
+
+		// Interpret the file as a giant string
+		std::stringstream stream;
+		stream << file.rdbuf();
+		file.close();
+
+		// Verify shader type matches shader file extension
+		const char* ext = strrchr(path, '.');
+		switch (type)
+		{
+		case GL_VERTEX_SHADER:
+			assert(strcmp(ext, ".vert") == 0);
+			break;
+
+		case GL_FRAGMENT_SHADER:
+			assert(strcmp(ext, ".frag") == 0);
+			break;
+		default:
+			assert(false && "Invalid shader type");
+			break;
+		}
+
+		// FrameData goes after the #version and #extension lines since those must come first.
+		// #line then restores the file's own line numbers for compile errors.
+		std::string str = stream.str();
+		size_t body = 0;
+		int line = 1;
+		while (str.compare(body, 8, "#version") == 0 || str.compare(body, 10, "#extension") == 0)
+		{
+			body = str.find('\n', body) + 1;
+			line++;
+		}
+		std::string preamble = FRAME_DATA_GLSL + ("#line " + std::to_string(line) + "\n");
+
+		// Our shaders target GLSL 4.60, but Mesa's llvmpipe (used for headless runs) stops at 4.50.
+		// The only 4.60 features we use are the draw parameters, which 4.50 has as an extension.
+		GLint major = 0, minor = 0;
+		glGetIntegerv(GL_MAJOR_VERSION, &major);
+		glGetIntegerv(GL_MINOR_VERSION, &minor);
+		size_t version = str.find("#version 460");
+		if (major * 10 + minor < 46 && version != std::string::npos)
+		{
+			str.replace(version, 12, "#version 450");
+			if (str.find("gl_DrawID") != std::string::npos || str.find("gl_BaseInstance") != std::string::npos)
+			{
+				preamble = "#extension GL_ARB_shader_draw_parameters : require\n"
+					"#define gl_DrawID gl_DrawIDARB\n"
+					"#define gl_BaseInstance gl_BaseInstanceARB\n" + preamble;
+			}
+		}
+		str.insert(body, preamble);
+
+		// Compile text as a shader
+		const char* src = str.c_str();
+		shader = glCreateShader(type);
+		glShaderSource(shader, 1, &src, NULL);
+		glCompileShader(shader);
+
+		// Check for compilation errors
+		GLint success;
+		GLchar infoLog[512];
+		glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
+		if (!success)
+		{
+			glGetShaderInfoLog(shader, 512, NULL, infoLog);
+			std::cout << "Shader failed to compile: \n" << infoLog << std::endl;
+		}
+	}
+	catch (std::ifstream::failure& e)
+	{
+		std::cout << "Shader (" << path << ") not found: " << e.what() << std::endl;
+		assert(false);
+	}
+
+	return shader;
+}
+
+Program CreateProgram(GLuint vs, GLuint fs)
+{
+	Program program;
+	program.id = glCreateProgram();
+	glAttachShader(program.id, vs);
+	glAttachShader(program.id, fs);
+	glLinkProgram(program.id);
+
+	// Check for linking errors
+	int success;
+	char infoLog[512];
+	glGetProgramiv(program.id, GL_LINK_STATUS, &success);
+	if (!success) {
+		glGetProgramInfoLog(program.id, 512, NULL, infoLog);
+		std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+		glDeleteProgram(program.id);
+		program.id = GL_NONE;
+		return program;
+	}
+
+	ReflectUniforms(&program);
+	return program;
+}
+
+void DestroyProgram(Program* program)
+{
+	glDeleteProgram(program->id);
+	program->id = GL_NONE;
+	program->uniforms.clear();
+}
+
+GLint GetUniform(const Program& program, uint32_t hash)
+{
+	auto it = std::lower_bound(program.uniforms.begin(), program.uniforms.end(), hash,
+		[](const Uniform& uniform, uint32_t hash) { return uniform.hash < hash; });
+	return it != program.uniforms.end() && it->hash == hash ? it->location : -1;
+}
+
+void SendInt(const Program& program, const char* name, int value)
+{
+	glUniform1i(GetUniform(program, name), value);
+}
+
+void SendFloat(const Program& program, const char* name, float value)
+{
+	glUniform1f(GetUniform(program, name), value);
+}
+
+void SendVec3(const Program& program, const char* name, Vector3 value)
+{
+	glUniform3fv(GetUniform(program, name), 1, &value.x);
+}
+
+void SendMat3(const Program& program, const char* name, Matrix value)
+{
+	glUniformMatrix3fv(GetUniform(program, name), 1, GL_FALSE, ToFloat9(value).v);
+}
+
+void SendMat4(const Program& program, const char* name, Matrix value)
+{
+	glUniformMatrix4fv(GetUniform(program, name), 1, GL_FALSE, ToFloat16(value).v);
+}
+
+void SendMat3(const Program& program, const char* name, Affine value)
+{
+	SendMat3(program, name, ToMatrix(value));
+}
+
+void SendMat4(const Program& program, const char* name, Affine value)
+{
+	SendMat4(program, name, ToMatrix(value));
+}
+
+InstanceData ToInstance(Affine world, Vector4 color)
+{
+	Affine normal = NormalMatrix(world);
+
+	InstanceData instance;
+	instance.world = ToFloat16(ToMatrix(world));
+	instance.normal[0] = { normal.m0, normal.m1, normal.m2, 0.0f };
+	instance.normal[1] = { normal.m4, normal.m5, normal.m6, 0.0f };
+	instance.normal[2] = { normal.m8, normal.m9, normal.m10, 0.0f };
+	instance.color = color;
+	return instance;
+}
+
+// Query every active uniform once so rendering never has to look up locations by string
+void ReflectUniforms(Program* program)
+{
+	GLint count = 0;
+	GLint maxLength = 0;
+	glGetProgramiv(program->id, GL_ACTIVE_UNIFORMS, &count);
+	glGetProgramiv(program->id, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxLength);
+
+	std::vector<char> name(maxLength + 1);
+	program->uniforms.reserve(count);
+	for (GLint i = 0; i < count; i++)
+	{
+		Uniform uniform;
+		GLsizei length = 0;
+		glGetActiveUniform(program->id, i, (GLsizei)name.size(), &length, &uniform.size, &uniform.type, name.data());
+
+		// Members of uniform blocks have no location
+		uniform.location = glGetUniformLocation(program->id, name.data());
+		if (uniform.location == -1)
+			continue;
+
+		// Arrays are reported as "u_name[0]", but we want to look them up as "u_name"
+		if (length > 3 && strcmp(name.data() + length - 3, "[0]") == 0)
+			name[length - 3] = '\0';
+
+		uniform.hash = Hash(name.data());
+		program->uniforms.push_back(uniform);
+	}
+
+	std::sort(program->uniforms.begin(), program->uniforms.end(),
+		[](const Uniform& a, const Uniform& b) { return a.hash < b.hash; });
+
+	// Two names hashing to the same value would make one of them unreachable
+	for (size_t i = 1; i < program->uniforms.size(); i++)
+		assert(program->uniforms[i - 1].hash != program->uniforms[i].hash);
+}
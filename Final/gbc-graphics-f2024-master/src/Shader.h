@@ -0,0 +1,113 @@
+#pragma once
+#include <glad/glad.h>
+#include <cstdint>
+#include <vector>
+#include "Math.h"
+
+// Active uniform reflected from a linked program
+struct Uniform
+{
+	uint32_t hash = 0;		// Hash of the uniform's name (see Hash below)
+	GLint location = -1;	// Location passed to glUniform*
+	GLenum type = GL_NONE;	// GL_FLOAT_VEC3, GL_FLOAT_MAT4, etc
+	GLint size = 0;			// Number of elements (1 unless the uniform is an array)
+};
+
+struct Program
+{
+	GLuint id = GL_NONE;
+
+	// Every active uniform, sorted by hash.
+	// Filled once at link-time so we never call glGetUniformLocation while rendering.
+	std::vector<Uniform> uniforms;
+};
+
+// Uniform block binding points. Must match layout(binding = N) in the shaders.
+enum UniformBinding : GLuint
+{
+	FRAME_BINDING = 0	// FrameData, written once per frame
+};
+
+// Shader storage buffer binding points. Must match layout(std430, binding = N) in the shaders.
+enum StorageBinding : GLuint
+{
+	INSTANCE_BINDING = 0,	// InstanceData array read by default_instanced.vert
+	DRAW_BINDING = 1		// InstanceData per multi-draw command, read by default_multidraw.vert
+};
+
+enum LightIndex : int
+{
+	LIGHT_POINT,
+	LIGHT_SPOT,
+	LIGHT_COUNT
+};
+
+// std140 layout, every member is padded to 16 bytes.
+// Must match "struct Light" in Shader.cpp's FRAME_DATA_GLSL.
+struct Light
+{
+	Vector4 position;	// xyz = world-space position
+	Vector4 color;		// xyz = rgb
+	Vector4 direction;	// xyz = direction (spot lights only)
+	float radius;		// Attenuation radius (point) or cone angle in degrees (spot)
+	float padding[3];
+};
+
+// Per-frame camera and light data shared by every program via a uniform buffer.
+// Must match "uniform FrameData" in Shader.cpp's FRAME_DATA_GLSL, which CreateShader prepends to every shader.
+struct FrameData
+{
+	float16 view;
+	float16 proj;
+	float16 viewProj;
+	Vector4 cameraPosition;	// xyz = world-space position
+	Light lights[LIGHT_COUNT];
+};
+// Per-instance data for instanced draws. std430 layout, mat3 columns are padded to 16 bytes.
+// Must match "struct Instance" in default_instanced.vert.
+struct InstanceData
+{
+	float16 world;
+	Vector4 normal[3];	// Columns of the normal matrix
+	Vector4 color;
+};
+
+static_assert(sizeof(Light) == 64, "Light must match its std140 layout");
+static_assert(sizeof(FrameData) == 3 * 64 + 16 + LIGHT_COUNT * 64, "FrameData must match its std140 layout");
+static_assert(sizeof(InstanceData) == 64 + 48 + 16, "InstanceData must match its std430 layout");
+
+// Instance with the world matrix, its normal matrix and a color
+InstanceData ToInstance(Affine world, Vector4 color);
+
+// FNV-1a string hash. constexpr so literal uniform names can be hashed at compile-time.
+constexpr uint32_t Hash(const char* str)
+{
+	uint32_t hash = 2166136261u;
+	while (*str != '\0')
+	{
+		hash ^= (uint8_t)*str++;
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+// Compile a shader
+GLuint CreateShader(GLint type, const char* path);
+
+// Combine two compiled shaders into a program that can run on the GPU, then reflect its uniforms
+Program CreateProgram(GLuint vs, GLuint fs);
+void DestroyProgram(Program* program);
+
+// Returns the uniform's location, or -1 if the program has no active uniform with the given name.
+// Like glUniform*, the setters below silently ignore uniforms that don't exist.
+GLint GetUniform(const Program& program, uint32_t hash);
+inline GLint GetUniform(const Program& program, const char* name) { return GetUniform(program, Hash(name)); }
+
+// Typed setters. The program must be bound (glUseProgram) before calling these.
+void SendInt(const Program& program, const char* name, int value);
+void SendFloat(const Program& program, const char* name, float value);
+void SendVec3(const Program& program, const char* name, Vector3 value);
+void SendMat3(const Program& program, const char* name, Matrix value);	// Upper-left 3x3 of value
+void SendMat4(const Program& program, const char* name, Matrix value);
+void SendMat3(const Program& program, const char* name, Affine value);	// Upper-left 3x3 of value
+void SendMat4(const Program& program, const char* name, Affine value);	// Promoted to a full matrix
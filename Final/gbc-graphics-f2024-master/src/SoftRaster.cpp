@@ -0,0 +1,564 @@
+#include "SoftRaster.h"
+#include <stb_image.h>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+
+#if defined(MATH_SSE) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SOFT_SSE2
+#include <emmintrin.h>
+#endif
+
+// Vertices are snapped to 1/16th of a pixel
+constexpr int SUBPIXEL_BITS = 4;
+constexpr int SUBPIXEL = 1 << SUBPIXEL_BITS;
+
+// Triangles are clipped to this many pixels around the viewport. Keeps subpixel coordinates under 2^18, so an edge
+// function that crosses a tile varies by less than 2^30 over it and can be stepped in 32 bits.
+constexpr int GUARD_BAND = 8192;
+
+constexpr int MAX_CLIPPED = 3 + 6;	// Every clip plane adds at most one vertex
+
+// default.vert's outputs
+struct ClipVertex
+{
+	Vector4 position;
+	float attributes[SOFT_ATTRIBUTES];	// World-space position, normal, tcoord
+};
+
+void CreateSoftRenderer(SoftRenderer* renderer, int width, int height, int threadCount)
+{
+	assert(width <= GUARD_BAND && height <= GUARD_BAND);
+	renderer->width = width;
+	renderer->height = height;
+	renderer->tilesX = (width + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE;
+	renderer->tilesY = (height + SOFT_TILE_SIZE - 1) / SOFT_TILE_SIZE;
+	renderer->color.assign(width * height, 0);
+	renderer->bins.resize(renderer->tilesX * renderer->tilesY);
+	CreateThreadPool(&renderer->pool, threadCount);
+}
+
+void DestroySoftRenderer(SoftRenderer* renderer)
+{
+	DestroyThreadPool(&renderer->pool);
+	renderer->color.clear();
+	renderer->bins.clear();
+	renderer->draws.clear();
+	renderer->triangles.clear();
+}
+
+void BeginSoftFrame(SoftRenderer* renderer, const FrameData& frame, Vector4 clearColor)
+{
+	renderer->frame = frame;
+	renderer->clearColor = clearColor;
+	renderer->draws.clear();
+	renderer->triangles.clear();
+	for (std::vector<int>& bin : renderer->bins)
+		bin.clear();
+}
+
+static float PlaneDistance(Vector4 plane, Vector4 v)
+{
+	return plane.x * v.x + plane.y * v.y + plane.z * v.z + plane.w * v.w;
+}
+
+static ClipVertex Lerp(const ClipVertex& a, const ClipVertex& b, float t)
+{
+	ClipVertex result;
+	result.position = a.position + (b.position - a.position) * t;
+	for (int i = 0; i < SOFT_ATTRIBUTES; i++)
+		result.attributes[i] = a.attributes[i] + (b.attributes[i] - a.attributes[i]) * t;
+	return result;
+}
+
+// Sutherland-Hodgman: keeps the part of the polygon on the positive side of the plane
+static int ClipPolygon(const ClipVertex* in, int count, ClipVertex* out, Vector4 plane)
+{
+	int result = 0;
+	for (int i = 0; i < count; i++)
+	{
+		const ClipVertex& a = in[i];
+		const ClipVertex& b = in[(i + 1) % count];
+		float da = PlaneDistance(plane, a.position);
+		float db = PlaneDistance(plane, b.position);
+		if (da >= 0.0f)
+			out[result++] = a;
+		if ((da >= 0.0f) != (db >= 0.0f))
+			out[result++] = Lerp(a, b, da / (da - db));
+	}
+	return result;
+}
+
+static float Evaluate(const float plane[3], float x, float y)
+{
+	return plane[0] * x + plane[1] * y + plane[2];
+}
+
+// Plane through the values at the three vertices (dx and dy are relative to vertex 0)
+static void SetPlane(float plane[3], float f0, float f1, float f2, float x0, float y0, float dx1, float dy1, float dx2, float dy2, float invArea)
+{
+	float df1 = f1 - f0;
+	float df2 = f2 - f0;
+	plane[0] = (df1 * dy2 - df2 * dy1) * invArea;
+	plane[1] = (df2 * dx1 - df1 * dx2) * invArea;
+	plane[2] = f0 - plane[0] * x0 - plane[1] * y0;
+}
+
+// Projects, snaps and bins a triangle that's already inside the guard band and between the near and far planes
+static void SetupTriangle(SoftRenderer* renderer, const ClipVertex* v[3], int draw)
+{
+	float x[3], y[3], depth[3], invW[3];
+	int32_t X[3], Y[3];
+	for (int i = 0; i < 3; i++)
+	{
+		Vector4 p = v[i]->position;
+		invW[i] = 1.0f / p.w;
+		X[i] = (int32_t)lrintf((p.x * invW[i] * 0.5f + 0.5f) * renderer->width * SUBPIXEL);
+		Y[i] = (int32_t)lrintf((0.5f - p.y * invW[i] * 0.5f) * renderer->height * SUBPIXEL);	// Rows go top to bottom
+		x[i] = X[i] / (float)SUBPIXEL;
+		y[i] = Y[i] / (float)SUBPIXEL;
+		depth[i] = p.z * invW[i] * 0.5f + 0.5f;
+	}
+
+	// Nothing is culled (like the GL path), so back faces are flipped to wind the same way as front faces
+	int64_t area = (int64_t)(X[1] - X[0]) * (Y[2] - Y[0]) - (int64_t)(Y[1] - Y[0]) * (X[2] - X[0]);
+	if (area == 0)
+		return;
+	int order[3] = { 0, 1, 2 };
+	if (area < 0)
+		std::swap(order[1], order[2]);
+
+	// Pixels whose centers (px * SUBPIXEL + SUBPIXEL / 2) are within the triangle's bounds
+	int minX = std::min({ X[0], X[1], X[2] }) - SUBPIXEL / 2;
+	int minY = std::min({ Y[0], Y[1], Y[2] }) - SUBPIXEL / 2;
+	int maxX = std::max({ X[0], X[1], X[2] }) - SUBPIXEL / 2;
+	int maxY = std::max({ Y[0], Y[1], Y[2] }) - SUBPIXEL / 2;
+	SoftTriangle triangle;
+	triangle.minX = std::max((minX + SUBPIXEL - 1) >> SUBPIXEL_BITS, 0);
+	triangle.minY = std::max((minY + SUBPIXEL - 1) >> SUBPIXEL_BITS, 0);
+	triangle.maxX = std::min(maxX >> SUBPIXEL_BITS, renderer->width - 1);
+	triangle.maxY = std::min(maxY >> SUBPIXEL_BITS, renderer->height - 1);
+	if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+		return;
+
+	// Edge i is opposite vertex i, so it's 0 on the edge and the triangle's area (times 2) at vertex i
+	for (int i = 0; i < 3; i++)
+	{
+		int a = order[(i + 1) % 3];
+		int b = order[(i + 2) % 3];
+		triangle.A[i] = Y[a] - Y[b];
+		triangle.B[i] = X[b] - X[a];
+		triangle.C[i] = (int64_t)X[a] * Y[b] - (int64_t)Y[a] * X[b];
+
+		// Top-left rule: a pixel exactly on a shared edge belongs to the triangle that edge is the top or left of, never to both
+		bool topLeft = triangle.A[i] > 0 || (triangle.A[i] == 0 && triangle.B[i] > 0);
+		if (!topLeft)
+			triangle.C[i]--;
+	}
+
+	// Winding doesn't matter for the planes
+	float dx1 = x[1] - x[0], dy1 = y[1] - y[0];
+	float dx2 = x[2] - x[0], dy2 = y[2] - y[0];
+	float invArea = 1.0f / (dx1 * dy2 - dx2 * dy1);
+	SetPlane(triangle.depth, depth[0], depth[1], depth[2], x[0], y[0], dx1, dy1, dx2, dy2, invArea);
+	SetPlane(triangle.invW, invW[0], invW[1], invW[2], x[0], y[0], dx1, dy1, dx2, dy2, invArea);
+	for (int i = 0; i < SOFT_ATTRIBUTES; i++)
+	{
+		SetPlane(triangle.attributes[i], v[0]->attributes[i] * invW[0], v[1]->attributes[i] * invW[1], v[2]->attributes[i] * invW[2],
+			x[0], y[0], dx1, dy1, dx2, dy2, invArea);
+	}
+	triangle.draw = draw;
+
+	int index = (int)renderer->triangles.size();
+	renderer->triangles.push_back(triangle);
+	for (int ty = triangle.minY / SOFT_TILE_SIZE; ty <= triangle.maxY / SOFT_TILE_SIZE; ty++)
+	{
+		for (int tx = triangle.minX / SOFT_TILE_SIZE; tx <= triangle.maxX / SOFT_TILE_SIZE; tx++)
+			renderer->bins[ty * renderer->tilesX + tx].push_back(index);
+	}
+}
+
+void Submit(SoftRenderer* renderer, const SoftDraw& draw)
+{
+	// Meshes without CPU data (still loading) draw nothing, like they do on the GL path
+	const Mesh& mesh = *draw.mesh;
+	if (mesh.positions.empty())
+		return;
+
+	int drawIndex = (int)renderer->draws.size();
+	renderer->draws.push_back(draw);
+
+	// default.vert, once per vertex
+	const float* viewProj = renderer->frame.viewProj.v;	// Column-major
+	const Affine& n = draw.normal;
+	std::vector<ClipVertex> vertices(mesh.positions.size());
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		Vector3 position = draw.world * mesh.positions[i];
+		Vector3 normal = mesh.normals[i];
+		Vector2 tcoord = mesh.tcoords.empty() ? V2_ZERO : mesh.tcoords[i];
+
+		ClipVertex& vertex = vertices[i];
+		vertex.position.x = viewProj[0] * position.x + viewProj[4] * position.y + viewProj[8] * position.z + viewProj[12];
+		vertex.position.y = viewProj[1] * position.x + viewProj[5] * position.y + viewProj[9] * position.z + viewProj[13];
+		vertex.position.z = viewProj[2] * position.x + viewProj[6] * position.y + viewProj[10] * position.z + viewProj[14];
+		vertex.position.w = viewProj[3] * position.x + viewProj[7] * position.y + viewProj[11] * position.z + viewProj[15];
+		vertex.attributes[0] = position.x;
+		vertex.attributes[1] = position.y;
+		vertex.attributes[2] = position.z;
+		vertex.attributes[3] = n.m0 * normal.x + n.m4 * normal.y + n.m8 * normal.z;
+		vertex.attributes[4] = n.m1 * normal.x + n.m5 * normal.y + n.m9 * normal.z;
+		vertex.attributes[5] = n.m2 * normal.x + n.m6 * normal.y + n.m10 * normal.z;
+		vertex.attributes[6] = tcoord.x;
+		vertex.attributes[7] = tcoord.y;
+	}
+
+	// Near and far planes, then the guard band (w * the guard band's extent in NDC)
+	float guardX = 2.0f * GUARD_BAND / renderer->width - 1.0f;
+	float guardY = 2.0f * GUARD_BAND / renderer->height - 1.0f;
+	const Vector4 clipPlanes[6] =
+	{
+		{ 0.0f, 0.0f, 1.0f, 1.0f },
+		{ 0.0f, 0.0f, -1.0f, 1.0f },
+		{ 1.0f, 0.0f, 0.0f, guardX },
+		{ -1.0f, 0.0f, 0.0f, guardX },
+		{ 0.0f, 1.0f, 0.0f, guardY },
+		{ 0.0f, -1.0f, 0.0f, guardY }
+	};
+
+	for (int i = 0; i + 2 < mesh.count; i += 3)
+	{
+		const ClipVertex* corners[3];
+		for (int j = 0; j < 3; j++)
+		{
+			int index = i + j;
+			if (mesh.indexType == GL_UNSIGNED_SHORT)
+				index = mesh.indices16[i + j];
+			else if (mesh.indexType == GL_UNSIGNED_INT)
+				index = (int)mesh.indices32[i + j];
+			corners[j] = &vertices[index];
+		}
+
+		// Skip triangles entirely outside the view volume, clip the ones crossing a clip plane
+		int outside = 0x3F, crossing = 0;
+		for (const ClipVertex* corner : corners)
+		{
+			Vector4 p = corner->position;
+			int codes = (p.x < -p.w) | (p.x > p.w) << 1 | (p.y < -p.w) << 2 | (p.y > p.w) << 3 | (p.z < -p.w) << 4 | (p.z > p.w) << 5;
+			outside &= codes;
+			for (int plane = 0; plane < 6; plane++)
+				crossing |= (PlaneDistance(clipPlanes[plane], p) < 0.0f) << plane;
+		}
+		if (outside != 0)
+			continue;
+		if (crossing == 0)
+		{
+			SetupTriangle(renderer, corners, drawIndex);
+			continue;
+		}
+
+		ClipVertex polygon[2][MAX_CLIPPED];
+		int polygonCount = 3;
+		for (int j = 0; j < 3; j++)
+			polygon[0][j] = *corners[j];
+		int curr = 0;
+		for (int plane = 0; plane < 6 && polygonCount >= 3; plane++)
+		{
+			if ((crossing & (1 << plane)) == 0)
+				continue;
+			polygonCount = ClipPolygon(polygon[curr], polygonCount, polygon[1 - curr], clipPlanes[plane]);
+			curr = 1 - curr;
+		}
+
+		for (int j = 1; j + 1 < polygonCount; j++)
+		{
+			const ClipVertex* fan[3] = { &polygon[curr][0], &polygon[curr][j], &polygon[curr][j + 1] };
+			SetupTriangle(renderer, fan, drawIndex);
+		}
+	}
+}
+
+static uint32_t ToRGBA8(Vector3 color)
+{
+	uint32_t r = (uint32_t)(Clamp(color.x, 0.0f, 1.0f) * 255.0f + 0.5f);
+	uint32_t g = (uint32_t)(Clamp(color.y, 0.0f, 1.0f) * 255.0f + 0.5f);
+	uint32_t b = (uint32_t)(Clamp(color.z, 0.0f, 1.0f) * 255.0f + 0.5f);
+	return r | (g << 8) | (b << 16) | (255u << 24);
+}
+
+static Vector3 Texel(const SoftTexture& texture, int x, int y)
+{
+	// GL_REPEAT
+	x %= texture.width;
+	y %= texture.height;
+	x += x < 0 ? texture.width : 0;
+	y += y < 0 ? texture.height : 0;
+	uint32_t texel = texture.texels[y * texture.width + x];
+	return { (texel & 0xFF) / 255.0f, ((texel >> 8) & 0xFF) / 255.0f, ((texel >> 16) & 0xFF) / 255.0f };
+}
+
+// GL_LINEAR
+static Vector3 Sample(const SoftTexture* texture, Vector2 tcoord)
+{
+	// Sampling a texture that isn't loaded yet gives black
+	if (texture == nullptr || texture->texels.empty())
+		return V3_ZERO;
+
+	float x = tcoord.x * texture->width - 0.5f;
+	float y = tcoord.y * texture->height - 0.5f;
+	float x0 = floorf(x);
+	float y0 = floorf(y);
+	float tx = x - x0;
+	float ty = y - y0;
+	int ix = (int)x0;
+	int iy = (int)y0;
+	Vector3 bottom = Lerp(Texel(*texture, ix, iy), Texel(*texture, ix + 1, iy), tx);
+	Vector3 top = Lerp(Texel(*texture, ix, iy + 1), Texel(*texture, ix + 1, iy + 1), tx);
+	return Lerp(bottom, top, ty);
+}
+
+// Same math as textureWithLight.frag
+static Vector3 TextureWithLight(const FrameData& frame, const SoftDraw& draw, Vector3 position, Vector3 normal, Vector2 tcoord)
+{
+	const Light& point = frame.lights[LIGHT_POINT];
+	const Light& spot = frame.lights[LIGHT_SPOT];
+	Vector3 pointPosition = { point.position.x, point.position.y, point.position.z };
+	Vector3 pointColor = { point.color.x, point.color.y, point.color.z };
+	Vector3 cameraPosition = { frame.cameraPosition.x, frame.cameraPosition.y, frame.cameraPosition.z };
+
+	// Point Light
+	Vector3 N = Normalize(normal);
+	Vector3 L = Normalize(pointPosition - position);
+	Vector3 V = Normalize(cameraPosition - position);
+	Vector3 R = Normalize(Reflect(L, N));
+	float dotNL = std::max(Dot(N, L), 0.0f);
+	float dotVR = std::max(Dot(V, R), 0.0f);
+
+	float dist = Length(pointPosition - position);
+	float attenuation = Clamp(point.radius / dist, 0.0f, 1.0f);
+
+	Vector3 lighting = pointColor * 0.3f + pointColor * dotNL + pointColor * powf(dotVR, 4.0f);
+	lighting = lighting * attenuation;
+
+	// Spot Light
+	Vector3 spotPosition = { spot.position.x, spot.position.y, spot.position.z };
+	Vector3 LSpot = Normalize(spotPosition - position);
+	Vector3 spotDir = Normalize(Vector3{ -spot.direction.x, -spot.direction.y, -spot.direction.z });
+	float theta = Dot(LSpot, spotDir);
+
+	float inCutoff = cosf(spot.radius / 2.0f * DEG2RAD);
+	float outCutoff = cosf((spot.radius / 2.0f + 0.5f) * DEG2RAD);
+	float epsilon = inCutoff - outCutoff;
+	float intensity = Clamp((theta - outCutoff) / epsilon, 0.0f, 1.0f);
+
+	Vector3 lightingSpot = Vector3{ spot.color.x, spot.color.y, spot.color.z } * 0.3f * intensity;
+
+	// Texture scrolling
+	Vector2 textureScroll = { tcoord.x + draw.texScrolling, tcoord.y };
+	return (lighting + lightingSpot) * Sample(draw.texture, textureScroll);
+}
+
+static uint32_t Shade(const FrameData& frame, const SoftDraw& draw, const float* attributes)
+{
+	Vector3 position = { attributes[0], attributes[1], attributes[2] };
+	Vector3 normal = { attributes[3], attributes[4], attributes[5] };
+	Vector2 tcoord = { attributes[6], attributes[7] };
+	switch (draw.shader)
+	{
+	case SOFT_UNIFORM_COLOR:
+		return ToRGBA8(draw.color);
+
+	case SOFT_NORMAL_COLOR:
+		return ToRGBA8(normal);
+
+	case SOFT_TCOORD_COLOR:
+		return ToRGBA8({ tcoord.x, tcoord.y, 0.0f });
+
+	default:
+		return ToRGBA8(TextureWithLight(frame, draw, position, normal, tcoord));
+	}
+}
+
+// Coverage and depth test (GL_LEQUAL) for the 4 pixels starting at x, writing the depth of those that pass.
+// e holds the edge functions of the first pixel, step how much they change per pixel.
+// Returns a bit per pixel that passed.
+static int Cover4(const int32_t e[3], const int32_t step[3], const float zPlane[3], float x, float y, float* depth)
+{
+#ifdef SOFT_SSE2
+	__m128i any = _mm_setzero_si128();
+	for (int i = 0; i < 3; i++)
+		any = _mm_or_si128(any, _mm_add_epi32(_mm_set1_epi32(e[i]), _mm_setr_epi32(0, step[i], step[i] * 2, step[i] * 3)));
+
+	// The sign bit of any is set if a pixel is outside any edge
+	__m128 inside = _mm_castsi128_ps(_mm_cmpgt_epi32(any, _mm_set1_epi32(-1)));
+	__m128 xs = _mm_add_ps(_mm_set1_ps(x), _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f));
+	__m128 z = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(zPlane[0]), xs), _mm_set1_ps(zPlane[1] * y + zPlane[2]));
+	__m128 d = _mm_load_ps(depth);
+	__m128 pass = _mm_and_ps(inside, _mm_cmple_ps(z, d));
+	_mm_store_ps(depth, _mm_or_ps(_mm_and_ps(pass, z), _mm_andnot_ps(pass, d)));
+	return _mm_movemask_ps(pass);
+#else
+	int mask = 0;
+	for (int lane = 0; lane < 4; lane++)
+	{
+		bool inside = (e[0] + step[0] * lane | e[1] + step[1] * lane | e[2] + step[2] * lane) >= 0;
+		float z = zPlane[0] * (x + lane) + (zPlane[1] * y + zPlane[2]);
+		if (inside && z <= depth[lane])
+		{
+			depth[lane] = z;
+			mask |= 1 << lane;
+		}
+	}
+	return mask;
+#endif
+}
+
+static void RasterTile(SoftRenderer* renderer, int tile, uint32_t* color, float* depth)
+{
+	int x0 = (tile % renderer->tilesX) * SOFT_TILE_SIZE;
+	int y0 = (tile / renderer->tilesX) * SOFT_TILE_SIZE;
+	int width = std::min(SOFT_TILE_SIZE, renderer->width - x0);
+	int height = std::min(SOFT_TILE_SIZE, renderer->height - y0);
+
+	Vector4 c = renderer->clearColor;
+	uint32_t clear = (ToRGBA8({ c.x, c.y, c.z }) & 0x00FFFFFFu) | ((uint32_t)(Clamp(c.w, 0.0f, 1.0f) * 255.0f + 0.5f) << 24);
+	std::fill(color, color + SOFT_TILE_SIZE * SOFT_TILE_SIZE, clear);
+	std::fill(depth, depth + SOFT_TILE_SIZE * SOFT_TILE_SIZE, 1.0f);
+
+	float attributes[SOFT_ATTRIBUTES];
+	for (int index : renderer->bins[tile])
+	{
+		const SoftTriangle& triangle = renderer->triangles[index];
+		const SoftDraw& draw = renderer->draws[triangle.draw];
+
+		// Part of the tile the triangle can cover (tile-relative), widened to whole groups of 4 pixels.
+		// Pixels past the screen's edge are still rasterized into the tile but never copied out.
+		int minX = std::max(triangle.minX - x0, 0) & ~3;
+		int maxX = std::min(triangle.maxX - x0, width - 1) | 3;
+		int minY = std::max(triangle.minY - y0, 0);
+		int maxY = std::min(triangle.maxY - y0, height - 1);
+
+		// Edges that cover the whole area are skipped. The rest cross it, so they fit in 32 bits over it.
+		int64_t left = (int64_t)(x0 + minX) * SUBPIXEL + SUBPIXEL / 2;
+		int64_t right = (int64_t)(x0 + maxX) * SUBPIXEL + SUBPIXEL / 2;
+		int64_t top = (int64_t)(y0 + minY) * SUBPIXEL + SUBPIXEL / 2;
+		int64_t bottom = (int64_t)(y0 + maxY) * SUBPIXEL + SUBPIXEL / 2;
+		int32_t e[3], stepX[3], stepY[3];
+		bool covered = true;
+		for (int i = 0; i < 3 && covered; i++)
+		{
+			int64_t corners[4] =
+			{
+				triangle.A[i] * left + triangle.B[i] * top + triangle.C[i],
+				triangle.A[i] * right + triangle.B[i] * top + triangle.C[i],
+				triangle.A[i] * left + triangle.B[i] * bottom + triangle.C[i],
+				triangle.A[i] * right + triangle.B[i] * bottom + triangle.C[i]
+			};
+			int64_t lowest = std::min({ corners[0], corners[1], corners[2], corners[3] });
+			int64_t highest = std::max({ corners[0], corners[1], corners[2], corners[3] });
+			covered = highest >= 0;
+			if (lowest >= 0)
+			{
+				e[i] = stepX[i] = stepY[i] = 0;
+			}
+			else
+			{
+				e[i] = (int32_t)corners[0];
+				stepX[i] = triangle.A[i] * SUBPIXEL;
+				stepY[i] = triangle.B[i] * SUBPIXEL;
+			}
+		}
+		if (!covered)
+			continue;
+
+		for (int y = minY; y <= maxY; y++)
+		{
+			int32_t row[3] = { e[0], e[1], e[2] };
+			float fy = y0 + y + 0.5f;
+			for (int x = minX; x <= maxX; x += 4)
+			{
+				float fx = x0 + x + 0.5f;
+				int mask = Cover4(row, stepX, triangle.depth, fx, fy, depth + y * SOFT_TILE_SIZE + x);
+				for (int lane = 0; lane < 4; lane++)
+				{
+					if ((mask & (1 << lane)) == 0)
+						continue;
+
+					// Perspective-correct attributes
+					float w = 1.0f / Evaluate(triangle.invW, fx + lane, fy);
+					for (int i = 0; i < SOFT_ATTRIBUTES; i++)
+						attributes[i] = Evaluate(triangle.attributes[i], fx + lane, fy) * w;
+					color[y * SOFT_TILE_SIZE + x + lane] = Shade(renderer->frame, draw, attributes);
+				}
+
+				for (int i = 0; i < 3; i++)
+					row[i] += stepX[i] * 4;
+			}
+
+			for (int i = 0; i < 3; i++)
+				e[i] += stepY[i];
+		}
+	}
+
+	for (int y = 0; y < height; y++)
+		std::copy(color + y * SOFT_TILE_SIZE, color + y * SOFT_TILE_SIZE + width, renderer->color.data() + (y0 + y) * renderer->width + x0);
+}
+
+// Every rasterizing thread runs this until there are no tiles left
+static void RasterTiles(SoftRenderer* renderer)
+{
+	alignas(16) uint32_t color[SOFT_TILE_SIZE * SOFT_TILE_SIZE];
+	alignas(16) float depth[SOFT_TILE_SIZE * SOFT_TILE_SIZE];
+	int tileCount = renderer->tilesX * renderer->tilesY;
+	while (true)
+	{
+		int tile;
+		{
+			std::lock_guard<std::mutex> lock(renderer->mutex);
+			tile = renderer->nextTile++;
+		}
+		if (tile >= tileCount)
+			break;
+		RasterTile(renderer, tile, color, depth);
+	}
+
+	std::lock_guard<std::mutex> lock(renderer->mutex);
+	if (--renderer->activeThreads == 0)
+		renderer->done.notify_one();
+}
+
+void EndSoftFrame(SoftRenderer* renderer)
+{
+	renderer->nextTile = 0;
+	renderer->activeThreads = (int)renderer->pool.threads.size() + 1;
+	for (size_t i = 0; i < renderer->pool.threads.size(); i++)
+		Submit(&renderer->pool, [renderer] { RasterTiles(renderer); });
+	RasterTiles(renderer);
+
+	std::unique_lock<std::mutex> lock(renderer->mutex);
+	renderer->done.wait(lock, [renderer] { return renderer->activeThreads == 0; });
+}
+
+bool LoadSoftTexture(SoftTexture* texture, const char* path)
+{
+	stbi_set_flip_vertically_on_load_thread(true);
+	int width = 0, height = 0, channels = 0;
+	stbi_uc* pixels = stbi_load(path, &width, &height, &channels, 4);
+	if (pixels == nullptr)
+	{
+		printf("**Warning: failed to load image %s (%s)**\n", path, stbi_failure_reason());
+		return false;
+	}
+
+	texture->width = width;
+	texture->height = height;
+	texture->texels.resize(width * height);
+	for (int i = 0; i < width * height; i++)
+	{
+		const stbi_uc* p = pixels + i * 4;
+		texture->texels[i] = p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+	}
+	stbi_image_free(pixels);
+	return true;
+}
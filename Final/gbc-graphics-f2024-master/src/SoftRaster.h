@@ -0,0 +1,107 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "Math.h"
+#include "Mesh.h"
+#include "Shader.h"
+#include "ThreadPool.h"
+
+// Software rasterizer that renders the same meshes and FrameData as the GL path, without a GL context.
+// Meant for CPU-only machines that still need to render and time frames. Only each mesh's CPU data is read.
+// Mesh.h and Shader.h are only included for their types, so this links without glad or a GL library (see bench/SoftBench.cpp).
+//
+// Submit transforms, clips and sets up a draw's triangles, then bins them into screen tiles.
+// EndSoftFrame rasterizes the tiles on the thread pool: each tile belongs to one thread, which owns the tile's
+// color and depth so nothing is shared or locked. Triangles are tested 4 pixels at a time (SSE edge functions),
+// and each tile draws its triangles in submission order like GL would.
+
+// Software versions of the fragment shaders of the same name. Every one runs after default.vert.
+enum SoftShader
+{
+	SOFT_UNIFORM_COLOR,
+	SOFT_NORMAL_COLOR,
+	SOFT_TCOORD_COLOR,
+	SOFT_TEXTURE_WITH_LIGHT
+};
+
+// Sampled like the GL path's 2D textures: bilinear, repeating, bottom row first
+struct SoftTexture
+{
+	int width = 0;
+	int height = 0;
+	std::vector<uint32_t> texels;	// RGBA8
+};
+
+// One draw and the uniforms its shaders read (same names as the GLSL uniforms)
+struct SoftDraw
+{
+	const Mesh* mesh = nullptr;
+	SoftShader shader = SOFT_UNIFORM_COLOR;
+	Affine world = AffineIdentity();	// u_world
+	Affine normal = AffineIdentity();	// u_normal, upper 3x3 only
+	Vector3 color = V3_ONE;				// u_color
+	const SoftTexture* texture = nullptr;	// u_tex
+	float texScrolling = 0.0f;			// u_tex_scrolling
+};
+
+constexpr int SOFT_TILE_SIZE = 64;		// Pixels per tile side. Must be a multiple of 4.
+constexpr int SOFT_ATTRIBUTES = 8;		// World-space position, normal and tcoord (default.vert's outputs)
+
+// Triangle after setup. Interpolated values are planes a * x + b * y + c over pixel centers.
+struct SoftTriangle
+{
+	// Edge functions A * x + B * y + C over subpixel coordinates, >= 0 inside (top-left fill rule folded into C)
+	int32_t A[3];
+	int32_t B[3];
+	int64_t C[3];
+
+	int minX, minY, maxX, maxY;	// Pixels whose centers might be covered, inclusive
+
+	float depth[3];		// Window-space depth
+	float invW[3];		// 1 / w, for perspective-correct attributes
+	float attributes[SOFT_ATTRIBUTES][3];	// Attribute / w
+	int draw;	// Index in SoftRenderer::draws
+};
+
+struct SoftRenderer
+{
+	int width = 0;
+	int height = 0;
+	int tilesX = 0;
+	int tilesY = 0;
+
+	// Final colors, rows top to bottom so they can be passed straight to WritePng
+	std::vector<uint32_t> color;
+	Vector4 clearColor = { 0.0f, 0.0f, 0.0f, 1.0f };
+
+	// This frame's camera and lights, the same ones the GL path uploads
+	FrameData frame;
+
+	std::vector<SoftDraw> draws;
+	std::vector<SoftTriangle> triangles;
+	std::vector<std::vector<int>> bins;	// Indices in triangles for each tile, in submission order
+
+	ThreadPool pool;
+	int nextTile = 0;		// Next tile a thread picks up
+	int activeThreads = 0;	// Threads still rasterizing
+	std::mutex mutex;
+	std::condition_variable done;
+};
+
+// threadCount = 0 uses one thread per core, minus one for the thread that calls EndSoftFrame (which also rasterizes)
+void CreateSoftRenderer(SoftRenderer* renderer, int width, int height, int threadCount = 0);
+void DestroySoftRenderer(SoftRenderer* renderer);
+
+// Starts a frame. Tiles are cleared to clearColor and depth 1 when they're rasterized.
+void BeginSoftFrame(SoftRenderer* renderer, const FrameData& frame, Vector4 clearColor = { 0.0f, 0.0f, 0.0f, 1.0f });
+
+// Sets up the draw's triangles right away, so the mesh and texture only need to outlive the frame
+void Submit(SoftRenderer* renderer, const SoftDraw& draw);
+
+// Rasterizes every tile and blocks until color holds the finished frame
+void EndSoftFrame(SoftRenderer* renderer);
+
+// Decodes an image into a texture, flipped the same way the GL path flips it on load
+bool LoadSoftTexture(SoftTexture* texture, const char* path);
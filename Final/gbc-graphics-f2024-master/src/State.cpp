@@ -0,0 +1,151 @@
+#include "State.h"
+
+RenderStats gRenderStats;
+
+// Texture units and targets whose bindings are shadowed. Others are always passed to GL.
+constexpr int MAX_TEXTURE_UNITS = 16;
+enum TextureSlot
+{
+	SLOT_2D,
+	SLOT_CUBE_MAP,
+	SLOT_COUNT
+};
+
+// Value that no real state has, so the first call after InvalidateState always reaches GL
+constexpr GLuint UNKNOWN = ~0u;
+
+// Last values set through the wrappers
+struct StateCache
+{
+	GLuint program;
+	GLuint vao;
+	GLenum activeUnit;
+	GLuint textures[MAX_TEXTURE_UNITS][SLOT_COUNT];
+	GLuint depthMask;
+	GLenum polygonMode;
+	GLuint blend;
+	GLenum blendSrc;
+	GLenum blendDst;
+};
+
+static StateCache UnknownState()
+{
+	StateCache state;
+	state.program = UNKNOWN;
+	state.vao = UNKNOWN;
+	state.activeUnit = UNKNOWN;
+	for (int unit = 0; unit < MAX_TEXTURE_UNITS; unit++)
+		for (int slot = 0; slot < SLOT_COUNT; slot++)
+			state.textures[unit][slot] = UNKNOWN;
+	state.depthMask = UNKNOWN;
+	state.polygonMode = UNKNOWN;
+	state.blend = UNKNOWN;
+	state.blendSrc = UNKNOWN;
+	state.blendDst = UNKNOWN;
+	return state;
+}
+
+static StateCache gState = UnknownState();
+
+// Returns true if the shadowed value changed, counting the call either way
+static bool Update(GLuint* shadow, GLuint value)
+{
+	if (*shadow == value)
+	{
+		gRenderStats.skippedStateChanges++;
+		return false;
+	}
+
+	*shadow = value;
+	gRenderStats.stateChanges++;
+	return true;
+}
+
+static int GetTextureSlot(GLenum target)
+{
+	switch (target)
+	{
+	case GL_TEXTURE_2D:
+		return SLOT_2D;
+	case GL_TEXTURE_CUBE_MAP:
+		return SLOT_CUBE_MAP;
+	default:
+		return SLOT_COUNT;
+	}
+}
+
+void InvalidateState()
+{
+	gState = UnknownState();
+}
+
+void UseProgram(GLuint program)
+{
+	if (Update(&gState.program, program))
+		glUseProgram(program);
+}
+
+void BindVertexArray(GLuint vao)
+{
+	if (Update(&gState.vao, vao))
+		glBindVertexArray(vao);
+}
+
+void ActiveTexture(GLenum unit)
+{
+	if (Update(&gState.activeUnit, unit))
+		glActiveTexture(unit);
+}
+
+void BindTexture(GLenum target, GLuint texture)
+{
+	int unit = gState.activeUnit - GL_TEXTURE0;
+	int slot = GetTextureSlot(target);
+	if (gState.activeUnit == UNKNOWN || unit >= MAX_TEXTURE_UNITS || slot == SLOT_COUNT)
+	{
+		gRenderStats.stateChanges++;
+		glBindTexture(target, texture);
+		return;
+	}
+
+	if (Update(&gState.textures[unit][slot], texture))
+		glBindTexture(target, texture);
+}
+
+void SetDepthMask(bool write)
+{
+	if (Update(&gState.depthMask, write ? GL_TRUE : GL_FALSE))
+		glDepthMask(write ? GL_TRUE : GL_FALSE);
+}
+
+void SetPolygonMode(GLenum mode)
+{
+	if (Update(&gState.polygonMode, mode))
+		glPolygonMode(GL_FRONT_AND_BACK, mode);
+}
+
+void SetBlend(bool enable)
+{
+	if (!Update(&gState.blend, enable ? GL_TRUE : GL_FALSE))
+		return;
+
+	if (enable)
+		glEnable(GL_BLEND);
+	else
+		glDisable(GL_BLEND);
+}
+
+void SetBlendFunc(GLenum src, GLenum dst)
+{
+	// Both have to match to skip, so count the pair as one call
+	if (gState.blendSrc == src && gState.blendDst == dst)
+	{
+		gRenderStats.skippedStateChanges++;
+		return;
+	}
+
+	gState.blendSrc = src;
+	gState.blendDst = dst;
+	gRenderStats.stateChanges++;
+	glBlendFunc(src, dst);
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <glad/glad.h>
+
+// Counters read by the Profiler. Reset by BeginFrame.
+struct RenderStats
+{
+	int drawCalls = 0;
+	int stateChanges = 0;	// Wrapper calls that reached GL
+	int skippedStateChanges = 0;	// Wrapper calls skipped because the state was already set
+	int visibleObjects = 0;	// Passed IsVisible
+	int culledObjects = 0;	// Rejected by IsVisible
+};
+extern RenderStats gRenderStats;
+
+// Wrappers around the GL state calls we make while rendering, so they can be counted.
+// Each one shadows the value it last set and skips the GL call if nothing would change,
+// so callers can set the state every draw needs without checking what's already bound.
+// Everything that changes this state must go through them (or call InvalidateState afterwards).
+void UseProgram(GLuint program);
+void BindVertexArray(GLuint vao);
+void ActiveTexture(GLenum unit);
+void BindTexture(GLenum target, GLuint texture);	// Binds to the active unit
+void SetDepthMask(bool write);
+void SetPolygonMode(GLenum mode);	// Applies to front and back faces
+void SetBlend(bool enable);
+void SetBlendFunc(GLenum src, GLenum dst);
+
+// Forget the shadowed state so the next call of each wrapper goes to GL
+void InvalidateState();
+
+// Every draw call should be followed by CountDraw
+inline void CountDraw() { gRenderStats.drawCalls++; }
@@ -0,0 +1,53 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+static void Work(ThreadPool* pool)
+{
+	while (true)
+	{
+		std::function<void()> job;
+		{
+			std::unique_lock<std::mutex> lock(pool->mutex);
+			pool->signal.wait(lock, [pool] { return pool->stop || !pool->jobs.empty(); });
+			if (pool->jobs.empty())
+				return;
+
+			job = std::move(pool->jobs.front());
+			pool->jobs.pop_front();
+		}
+		job();
+	}
+}
+
+void CreateThreadPool(ThreadPool* pool, int threadCount)
+{
+	if (threadCount <= 0)
+		threadCount = std::max((int)std::thread::hardware_concurrency() - 1, 1);
+
+	pool->stop = false;
+	pool->threads.reserve(threadCount);
+	for (int i = 0; i < threadCount; i++)
+		pool->threads.emplace_back(Work, pool);
+}
+
+void DestroyThreadPool(ThreadPool* pool)
+{
+	{
+		std::lock_guard<std::mutex> lock(pool->mutex);
+		pool->stop = true;
+	}
+	pool->signal.notify_all();
+
+	for (std::thread& thread : pool->threads)
+		thread.join();
+	pool->threads.clear();
+}
+
+void Submit(ThreadPool* pool, std::function<void()> job)
+{
+	{
+		std::lock_guard<std::mutex> lock(pool->mutex);
+		pool->jobs.push_back(std::move(job));
+	}
+	pool->signal.notify_one();
+}
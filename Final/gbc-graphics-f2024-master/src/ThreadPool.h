@@ -0,0 +1,25 @@
+#pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed set of worker threads that run jobs in the order they were submitted
+struct ThreadPool
+{
+	std::vector<std::thread> threads;
+	std::deque<std::function<void()>> jobs;
+	std::mutex mutex;
+	std::condition_variable signal;
+	bool stop = false;
+};
+
+// threadCount = 0 uses one thread per core, minus one for the main thread
+void CreateThreadPool(ThreadPool* pool, int threadCount = 0);
+
+// Waits for every submitted job to finish, then joins the threads
+void DestroyThreadPool(ThreadPool* pool);
+
+void Submit(ThreadPool* pool, std::function<void()> job);
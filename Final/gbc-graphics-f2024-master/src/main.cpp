@@ -1,6 +1,15 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "AssetLoader.h"
+#include "FrameStats.h"
+#include "Headless.h"
 #include "Mesh.h"
+#include "MeshPool.h"
+#include "Profiler.h"
+#include "RenderQueue.h"
+#include "RingBuffer.h"
+#include "Shader.h"
+#include "State.h"
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -15,18 +24,22 @@
 #include <fstream>
 #include <sstream>
 #include <array>
+#include <cfloat>
+#include <chrono>
+#include <cstring>
+#include <vector>
 
 constexpr int SCREEN_WIDTH = 1280;
 constexpr int SCREEN_HEIGHT = 720;
 constexpr float SCREEN_ASPECT = SCREEN_WIDTH / (float)SCREEN_HEIGHT;
 
+// Simulated time between headless frames, so every run animates identically
+constexpr float HEADLESS_DT = 1.0f / 60.0f;
+
 void APIENTRY glDebugOutput(GLenum source, GLenum type, unsigned int id, GLenum severity, GLsizei length, const char* message, const void* userParam);
 void key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
 void error_callback(int error, const char* description);
 
-GLuint CreateShader(GLint type, const char* path);
-GLuint CreateProgram(GLuint vs, GLuint fs);
-
 std::array<int, GLFW_KEY_LAST> gKeysCurr{}, gKeysPrev{};
 bool IsKeyDown(int key);
 bool IsKeyUp(int key);
@@ -34,6 +47,9 @@ bool IsKeyPressed(int key);
 
 void Print(Matrix m);
 
+// Seconds since startup. Used instead of glfwGetTime so headless runs never have to initialize GLFW.
+double GetTime();
+
 enum Projection : int
 {
     ORTHO,  // Orthographic, 2D
@@ -46,22 +62,55 @@ struct Line
     Vector2 end;
 };
 
-int main(void)
+int main(int argc, char** argv)
 {
+    // --headless renders offscreen (no window or UI) with a fixed timestep, then prints frame-time statistics.
+    // --frames N sets how many frames to render (default 600), --png path saves the final frame.
+    bool headless = false;
+    int headlessFrames = 600;
+    const char* pngPath = nullptr;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--headless") == 0)
+            headless = true;
+        else if (strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+            headlessFrames = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--png") == 0 && i + 1 < argc)
+            pngPath = argv[++i];
+    }
+    if (headlessFrames <= 0)
+    {
+        printf("--frames must be a positive number of frames\n");
+        return EXIT_FAILURE;
+    }
+
     glfwSetErrorCallback(error_callback);
-    assert(glfwInit() == GLFW_TRUE);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+    GLFWwindow* window = nullptr;
+    HeadlessContext headlessContext;
+    if (headless)
+    {
+        // GLFW isn't initialized at all, so this runs without a display (and with any GLFW version)
+        if (!CreateHeadlessContext(&headlessContext, SCREEN_WIDTH, SCREEN_HEIGHT))
+            return EXIT_FAILURE;
+    }
+    else
+    {
+        if (glfwInit() != GLFW_TRUE)
+            return EXIT_FAILURE;
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
 #ifdef NDEBUG
 #else
-    glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
+        glfwWindowHint(GLFW_OPENGL_DEBUG_CONTEXT, GL_TRUE);
 #endif
-    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+        glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
-    GLFWwindow* window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Graphics 1", NULL, NULL);
-    glfwMakeContextCurrent(window);
-    assert(gladLoadGLLoader((GLADloadproc)glfwGetProcAddress));
-    glfwSetKeyCallback(window, key_callback);
+        window = glfwCreateWindow(SCREEN_WIDTH, SCREEN_HEIGHT, "Graphics 1", NULL, NULL);
+        glfwMakeContextCurrent(window);
+        if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+            return EXIT_FAILURE;
+        glfwSetKeyCallback(window, key_callback);
+    }
 
 #ifdef NDEBUG
 #else
@@ -69,19 +118,24 @@ int main(void)
     glDebugMessageCallback(glDebugOutput, nullptr);
 #endif
 
-    IMGUI_CHECKVERSION();
-    ImGui::CreateContext();
-    ImGui::StyleColorsDark();
-    //ImGuiIO& io = ImGui::GetIO(); (void)io;
-    //io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
-    //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
-    ImGui_ImplGlfw_InitForOpenGL(window, true);
-    ImGui_ImplOpenGL3_Init("#version 460");
+    if (!headless)
+    {
+        IMGUI_CHECKVERSION();
+        ImGui::CreateContext();
+        ImGui::StyleColorsDark();
+        //ImGuiIO& io = ImGui::GetIO(); (void)io;
+        //io.ConfigFlags |= ImGuiConfigFlags_NavEnableKeyboard;     // Enable Keyboard Controls
+        //io.ConfigFlags |= ImGuiConfigFlags_NavEnableGamepad;      // Enable Gamepad Controls
+        ImGui_ImplGlfw_InitForOpenGL(window, true);
+        ImGui_ImplOpenGL3_Init("#version 460");
+    }
 
     // Vertex shaders:
     GLuint vs = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/default.vert");
     GLuint vsSkybox = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/skybox.vert");
     GLuint vsReflect = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/reflect.vert");
+    GLuint vsInstanced = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/default_instanced.vert");
+    GLuint vsMultiDraw = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/default_multidraw.vert");
     
     // Fragment shaders:
     GLuint fsUniformColor = CreateShader(GL_FRAGMENT_SHADER, "./assets/shaders/uniform_color.frag");
@@ -91,36 +145,28 @@ int main(void)
     GLuint fsTextureWithLight = CreateShader(GL_FRAGMENT_SHADER, "./assets/shaders/textureWithLight.frag");
     GLuint fsRefract = CreateShader(GL_FRAGMENT_SHADER, "./assets/shaders/refract.frag");
     GLuint fsReflect = CreateShader(GL_FRAGMENT_SHADER, "./assets/shaders/reflect.frag");
+    GLuint fsVertexColor = CreateShader(GL_FRAGMENT_SHADER, "./assets/shaders/vertex_color.frag");
     
     // Shader programs:
-    GLuint shaderUniformColor = CreateProgram(vs, fsUniformColor);
-    GLuint shaderSkybox = CreateProgram(vsSkybox, fsSkybox);
-    GLuint shaderTcoords = CreateProgram(vs, fsTcoords);
-    GLuint shaderNormals = CreateProgram(vs, fsNormals);
-    GLuint shaderTextureWithPoint = CreateProgram(vs, fsTextureWithLight);
-    GLuint shaderRefract = CreateProgram(vsReflect, fsRefract);
-    GLuint shaderReflect = CreateProgram(vsReflect, fsReflect);
-
-    // Step 1: Load image from disk to CPU
-    stbi_set_flip_vertically_on_load(true);
-
-    int tBackgroundWidth = 0;
-    int tBackgroundHeight = 0;
-    int tBackgroundChannels = 0;
-    stbi_uc* backgroundPixels = stbi_load("./assets/textures/water_Color.jpg", &tBackgroundWidth, &tBackgroundHeight, &tBackgroundChannels, 0);
-
-    // Step 2: Upload image from CPU to GPU
+    Program shaderUniformColor = CreateProgram(vs, fsUniformColor);
+    Program shaderSkybox = CreateProgram(vsSkybox, fsSkybox);
+    Program shaderTcoords = CreateProgram(vs, fsTcoords);
+    Program shaderNormals = CreateProgram(vs, fsNormals);
+    Program shaderTextureWithPoint = CreateProgram(vs, fsTextureWithLight);
+    Program shaderRefract = CreateProgram(vsReflect, fsRefract);
+    Program shaderReflect = CreateProgram(vsReflect, fsReflect);
+    Program shaderInstancedColor = CreateProgram(vsInstanced, fsVertexColor);
+    Program shaderPooledColor = CreateProgram(vsMultiDraw, fsVertexColor);
+
+    // Meshes and textures are parsed and decoded on worker threads, then uploaded a few per frame.
+    // Anything not uploaded yet draws as nothing (meshes) or black (textures) until it arrives.
+    double loadStart = GetTime();
+    AssetLoader loader;
+    CreateAssetLoader(&loader);
 
     GLuint backgroundTexture = GL_NONE;
-    glGenTextures(1, &backgroundTexture);
-    glBindTexture(GL_TEXTURE_2D, backgroundTexture);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, tBackgroundWidth, tBackgroundHeight, 0, GL_RGB, GL_UNSIGNED_BYTE, backgroundPixels);
-    stbi_image_free(backgroundPixels);
-    backgroundPixels = nullptr;
+    LoadTextureAsync(&loader, &backgroundTexture, "./assets/textures/water_Color.jpg");
+
     const char* skyBoxPath[6] =
     {
         "./assets/textures/skybox_x+.jpg",
@@ -131,22 +177,8 @@ int main(void)
         "./assets/textures/skybox_z-.jpg"
     };
     GLuint skyBoxTexture = GL_NONE;
-    glGenTextures(1, &skyBoxTexture);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, skyBoxTexture);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    stbi_set_flip_vertically_on_load(false);
-    for (int i = 0; i < 6; i++)
-    {
-        int w, h, c;
-        stbi_uc* pixels = stbi_load(skyBoxPath[i], &w, &h, &c, 0);
-        glTexImage2D(GL_TEXTURE_CUBE_MAP_POSITIVE_X + i, 0, GL_RGB, w, h, 0, GL_RGB, GL_UNSIGNED_BYTE, pixels);
-        stbi_image_free(pixels);
-    }
-    stbi_set_flip_vertically_on_load(true);
+    LoadCubemapAsync(&loader, &skyBoxTexture, skyBoxPath);
+
     // Positions of our triangle's vertices (CCW winding-order)
     Vector3 positions[] =
     {
@@ -212,9 +244,6 @@ int main(void)
 
     glBindVertexArray(GL_NONE);
 
-    GLint u_color = glGetUniformLocation(shaderUniformColor, "u_color");
-    GLint u_intensity = glGetUniformLocation(shaderUniformColor, "u_intensity");
-
     int object = 0;
     printf("Object %i\n", object + 1);
 
@@ -237,10 +266,35 @@ int main(void)
     bool imguiDemo = false;
     bool camToggle = false;
 
+    // Per-frame uniforms, instances and indirect commands are written straight into this mapped buffer
+    RingBuffer ring;
+    CreateRingBuffer(&ring, 1 << 20);
+
+    // Camera and light data shared by every program, written once per frame
+    FrameData frameData;
+
+    Profiler profiler;
+    CreateProfiler(&profiler);
+    bool showProfiler = true;
+
+    // Scene draws are recorded here, then issued sorted by state once per frame
+    RenderQueue queue;
+    CreateRenderQueue(&queue, &ring);
+
     Mesh sphereMesh, cubeMesh;
-    CreateMesh(&sphereMesh, "assets/meshes/uvsphere.obj");
+    LoadMeshAsync(&loader, &sphereMesh, "assets/meshes/uvsphere.obj", INTERLEAVED);
     CreateMesh(&cubeMesh, CUBE);
 
+    // Meshes drawn through the pool can share a multi-draw even when they differ
+    MeshPool meshPool;
+    CreateMeshPool(&meshPool, 65536, 262144);
+    PoolMesh spherePooled;
+
+    // Object 3's grid of spheres, refilled every frame
+    constexpr int SPHERE_GRID_SIZE = 16;
+    std::vector<InstanceData> sphereInstances;
+    sphereInstances.reserve(SPHERE_GRID_SIZE * SPHERE_GRID_SIZE);
+
     float camPitch = 0;
     float camYaw = 0;
     float camSpeed = 10.0f;
@@ -260,15 +314,44 @@ int main(void)
     glEnable(GL_DEPTH_TEST);
     glDepthFunc(GL_LEQUAL);
 
-    float timePrev = glfwGetTime();
-    float timeCurr = glfwGetTime();
+    float timePrev = GetTime();
+    float timeCurr = GetTime();
     float dt = 0.0f;
 
+    // Headless runs must be reproducible, so everything is loaded before the first frame
+    if (headless)
+        WaitForAssets(&loader);
+    int frameIndex = 0;
+    std::vector<float> frameTimes;
+    if (headless)
+        frameTimes.reserve(headlessFrames);
+
     double pmx = 0.0, pmy = 0.0, mx = 0.0, my = 0.0;
+    bool firstFrame = true;
     /* Loop until the user closes the window */
-    while (!glfwWindowShouldClose(window))
+    while (headless ? frameIndex < headlessFrames : !glfwWindowShouldClose(window))
     {
-        float time = glfwGetTime();
+        std::chrono::steady_clock::time_point frameStart = std::chrono::steady_clock::now();
+
+        // Upload whatever the workers have finished, spending at most 2ms of the frame doing so
+        if (IsLoading(loader))
+        {
+            UpdateAssetLoader(&loader, 2.0);
+            if (!IsLoading(loader))
+                printf("Assets loaded in %.2fms\n", (GetTime() - loadStart) * 1000.0);
+        }
+        // The sphere is empty until the loader uploads it
+        if (spherePooled.count == 0 && sphereMesh.vao != GL_NONE)
+            spherePooled = AddMesh(&meshPool, sphereMesh);
+        BeginFrame(&profiler);
+        BeginRingFrame(&ring);
+        if (firstFrame)
+        {
+            printf("First frame after %.2fms\n", (GetTime() - loadStart) * 1000.0);
+            firstFrame = false;
+        }
+
+        float time = headless ? frameIndex * HEADLESS_DT : GetTime();
         timePrev = time;
         camRot = FromEuler(-camPitch * DEG2RAD, -camYaw * DEG2RAD, 0.0f);
         Matrix camRotation = ToMatrix(FromEuler(camPitch * DEG2RAD, camYaw * DEG2RAD, 0.0f));
@@ -283,7 +366,8 @@ int main(void)
         float texScrolling = time / 8;
 
         pmx = mx; pmy = my;
-        glfwGetCursorPos(window, &mx, &my);
+        if (!headless)
+            glfwGetCursorPos(window, &mx, &my);
         Vector2 mouseDelta = { mx - pmx, my - pmy };
         float mouseScale = 1.0f;
 
@@ -376,33 +460,45 @@ int main(void)
         Matrix r = ToMatrix(rC);
         Matrix t = Translate(tC);
 
-        Matrix world = MatrixIdentity();
-        Matrix normal = MatrixIdentity();
+        Affine world = AffineIdentity();
+        Affine normal = AffineIdentity();
         Matrix view = LookAt(cameraPos, cameraPos - Rotate(cameraDir, camRot), V3_UP);
         Matrix proj = projection == ORTHO ? Ortho(left, right, bottom, top, near, far) : Perspective(fov, SCREEN_ASPECT, near, far);
-        Matrix mvp = MatrixIdentity();
-        GLint u_world = -2;
-        GLint u_normal = -2;
-        GLint u_mvp = -2;
-        GLint u_tex = -2;
-        GLint u_cubemap = -2;
-        GLint u_ratio = -2;
-        GLuint shaderProgram = GL_NONE;
-
-        // Light handle
-        GLint u_cameraPositionPoint = -2;
-        GLint u_lightPositionPoint = -2;
-        GLint u_lightColorPoint = -2;
-        GLint u_lightRadiusPoint = -2;
-        GLint u_lightPositionDir = -2;
-        GLint u_lightPositionSpot = -2;
-        GLint u_lightColorSpot = -2;
-        GLint u_lightDirSpot = -2;
-        GLint u_lightRadiusSpot = -2;
-        GLint u_tex_scrolling = -2;
-
+        ViewFrustum frustum = ToViewFrustum(view * proj);
         Matrix rotationY = RotateY(100.0f * time * DEG2RAD);
         Matrix rotationX = RotateX(100.0f * time * DEG2RAD);
+
+        // Translates the positions of the light spheres
+        Vector3 pointLightSpherePosition = { 1.5 * sin(time + -14.66), 0.0, 1.5 * cos(time + -14.66) };
+        pointLightSpherePosition += lightPositionOrbit;
+
+        Vector3 spotLightSpherePosition = { 1.5 * sin(time + -29.32), 0.0, 1.5 * cos(time + -29.32) };
+        spotLightSpherePosition += lightPositionOrbit;
+
+        // Translates and Rotates the Point Light
+        Matrix rotationMatrixZPoint = RotateZ(60 * DEG2RAD);
+        Vector3 rotatedPointLightPosition = rotationMatrixZPoint * pointLightSpherePosition;
+        rotatedPointLightPosition += lightPositionOrbit;
+
+        // Translates, Rotates and points the Spot Light
+        Matrix rotationMatrixZSpot = RotateZ(150 * DEG2RAD);
+        Vector3 rotatedSpotLightPosition = rotationMatrixZSpot * spotLightSpherePosition;
+        rotatedSpotLightPosition += lightPositionOrbit;
+        Vector3 adjustedSpotLightDirection = Normalize(rotatedSpotLightPosition * -1);
+
+        // Upload camera & lights once rather than to every program that needs them
+        frameData.view = ToFloat16(view);
+        frameData.proj = ToFloat16(proj);
+        frameData.viewProj = ToFloat16(view * proj);
+        frameData.cameraPosition = cameraPos;
+        frameData.lights[LIGHT_POINT].position = rotatedPointLightPosition;
+        frameData.lights[LIGHT_POINT].color = lightColor;
+        frameData.lights[LIGHT_POINT].radius = lightRadius;
+        frameData.lights[LIGHT_SPOT].position = rotatedSpotLightPosition;
+        frameData.lights[LIGHT_SPOT].color = lightColorSpot;
+        frameData.lights[LIGHT_SPOT].direction = adjustedSpotLightDirection;
+        frameData.lights[LIGHT_SPOT].radius = lightRadiusSpot;
+        BindRange(ring, Push(&ring, &frameData, sizeof(FrameData)), GL_UNIFORM_BUFFER, FRAME_BINDING);
         
         switch (object + 1)
         {
@@ -415,219 +511,147 @@ int main(void)
             Vector3 normalSpherePosition = { 1.5 * sin(time + -7.33), 0.0, 1.5 * cos(time + -7.33) };
             normalSpherePosition += lightPositionOrbit;
 
-            Vector3 pointLightSpherePosition = { 1.5 * sin(time + -14.66), 0.0, 1.5 * cos(time + -14.66) };
-            pointLightSpherePosition += lightPositionOrbit;
-
-            Vector3 spotLightSpherePosition = { 1.5 * sin(time + -29.32), 0.0, 1.5 * cos(time + -29.32) };
-            spotLightSpherePosition += lightPositionOrbit;
-
             Vector3 refractionSpherePosition = { 1.5 * sin(time + -36.65), 0.0, 1.5 * cos(time + -36.65) };
             refractionSpherePosition += lightPositionOrbit;
 
             Vector3 reflectionSpherePosition = { 1.5 * sin(time + -21.99), 0.0, 1.5 * cos(time + -21.99) };
             reflectionSpherePosition += lightPositionOrbit;
 
-            // Translates and Rotates the Point Light
-            Matrix rotationMatrixZPoint = RotateZ(60 * DEG2RAD);
-            Vector3 rotatedPointLightPosition = rotationMatrixZPoint * pointLightSpherePosition;
-            rotatedPointLightPosition += lightPositionOrbit;
-
-            // Translates, Rotates and points the Spot Light
-            Matrix rotationMatrixZSpot = RotateZ(150 * DEG2RAD);
-            Vector3 rotatedSpotLightPosition = rotationMatrixZSpot * spotLightSpherePosition;
-            rotatedSpotLightPosition += lightPositionOrbit;
-            Vector3 adjustedSpotLightDirection = Normalize(rotatedSpotLightPosition * -1);
-
             // Retains the world before it gets overridden
-            Matrix reflectWorld = world;
+            Affine reflectWorld = world;
 
             // Draws the skybox
-            shaderProgram = shaderSkybox;
-            glUseProgram(shaderProgram);
-            Matrix viewSky = view;
-            viewSky.m12 = viewSky.m13 = viewSky.m14 = 0.0f;
-            mvp = world * viewSky * proj;
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glBindTexture(GL_TEXTURE_CUBE_MAP, skyBoxTexture);
-            glDepthMask(GL_FALSE);
-            DrawMesh(cubeMesh);
-            glDepthMask(GL_TRUE);
+            Submit(&queue, PASS_SKYBOX, shaderSkybox, cubeMesh, 0.0f, { GL_FILL, false });
+            SetTexture(&queue, 0, GL_TEXTURE_CUBE_MAP, skyBoxTexture);
 
             // Draws the center sphere with moving texture and light info
-            shaderProgram = shaderTextureWithPoint;
-            //shaderProgram = shaderNormals;
-            glUseProgram(shaderProgram);
-            world = Translate(0.0f, 0.0f, 0.0f);
-            normal = NormalMatrix(world);
-            mvp = world * view * proj;
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            u_tex = glGetUniformLocation(shaderProgram, "u_tex");
-            u_world = glGetUniformLocation(shaderProgram, "u_world");
-            u_normal = glGetUniformLocation(shaderProgram, "u_normal");
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            u_tex = glGetUniformLocation(shaderProgram, "u_tex");
-            u_cameraPositionPoint = glGetUniformLocation(shaderProgram, "u_cameraPositionPoint");
-            u_lightPositionPoint = glGetUniformLocation(shaderProgram, "u_lightPositionPoint");
-            u_lightColorPoint = glGetUniformLocation(shaderProgram, "u_lightColorPoint");
-            u_lightRadiusPoint = glGetUniformLocation(shaderProgram, "u_lightRadiusPoint");
-            u_lightPositionSpot = glGetUniformLocation(shaderProgram, "u_lightPositionSpot");
-            u_lightColorSpot = glGetUniformLocation(shaderProgram, "u_lightColorSpot");
-            u_lightRadiusSpot = glGetUniformLocation(shaderProgram, "u_lightRadiusSpot");
-            u_lightDirSpot = glGetUniformLocation(shaderProgram, "u_lightDirSpot");
-            u_tex_scrolling = glGetUniformLocation(shaderProgram, "u_tex_scrolling");
-            glUniformMatrix4fv(u_world, 1, GL_FALSE, ToFloat16(world).v);
-            glUniformMatrix3fv(u_normal, 1, GL_FALSE, ToFloat9(normal).v);
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glUniform3fv(u_lightPositionPoint, 1, &cameraPos.x);
-            glUniform3fv(u_lightPositionPoint, 1, &rotatedPointLightPosition.x);
-            glUniform3fv(u_lightColorPoint, 1, &lightColor.x);
-            glUniform1f(u_lightRadiusPoint, lightRadius);
-            glUniform3fv(u_lightPositionSpot, 1, &cameraPos.x);
-            glUniform3fv(u_lightPositionSpot, 1, &rotatedSpotLightPosition.x);
-            glUniform3fv(u_lightColorSpot, 1, &lightColorSpot.x);
-            glUniform3fv(u_lightDirSpot, 1, &adjustedSpotLightDirection.x);
-            glUniform1f(u_lightRadiusSpot, lightRadiusSpot);
-            glUniform1f(u_tex_scrolling, texScrolling);
-            glUniform1i(u_tex, 0);
-            glActiveTexture(GL_TEXTURE0);
-            glBindTexture(GL_TEXTURE_2D, backgroundTexture);
-            DrawMesh(sphereMesh);
+            world = AffineTranslate(0.0f, 0.0f, 0.0f);
+            if (IsVisible(&queue, PASS_LIT, sphereMesh, world, frustum))
+            {
+                normal = NormalMatrix(world);
+                Submit(&queue, PASS_LIT, shaderTextureWithPoint, sphereMesh, Distance(cameraPos, Translation(world)));
+                SetTexture(&queue, 0, GL_TEXTURE_2D, backgroundTexture);
+                SendMat4(&queue, "u_world", world);
+                SendMat3(&queue, "u_normal", normal);
+                SendFloat(&queue, "u_tex_scrolling", texScrolling);
+                SendInt(&queue, "u_tex", 0);
+            }
 
             // Draws the sphere mesh with texture coordinates
-            shaderProgram = shaderTcoords;
-            glUseProgram(shaderProgram);
-            world = Scale(V3_ONE) * Translate(tcoordsSpherePosition);
-            mvp = world * view * proj;
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            DrawMesh(sphereMesh);
+            world = AffineScale(V3_ONE) * AffineTranslate(tcoordsSpherePosition);
+            if (IsVisible(&queue, PASS_DEBUG, sphereMesh, world, frustum))
+            {
+                Submit(&queue, PASS_DEBUG, shaderTcoords, sphereMesh, Distance(cameraPos, Translation(world)));
+                SendMat4(&queue, "u_world", world);
+            }
             
             // Draws the sphere mesh with normals
-            shaderProgram = shaderNormals;
-            glUseProgram(shaderProgram);
-            world = Scale(V3_ONE) * Translate(normalSpherePosition) * RotateZ(30 * DEG2RAD);
-            normal = NormalMatrix(world);
-            mvp = world * view * proj;
-            u_normal = glGetUniformLocation(shaderProgram, "u_normal");
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            glUniformMatrix3fv(u_normal, 1, GL_FALSE, ToFloat9(normal).v);
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            DrawMesh(sphereMesh);
-            
-            // Draws the Point Light with sphere outline
-            shaderProgram = shaderUniformColor;
-            glUseProgram(shaderProgram);
-            world = Scale(V3_ONE * lightRadius) * Translate(pointLightSpherePosition) * RotateZ(60 * DEG2RAD);
-            mvp = world * view * proj;
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            u_color = glGetUniformLocation(shaderProgram, "u_color");
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glUniform3fv(u_color, 1, &lightColor.x);
-            glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-            DrawMesh(sphereMesh); // Draw orbit light source
-            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+            world = AffineScale(V3_ONE) * AffineTranslate(normalSpherePosition) * AffineRotateZ(30 * DEG2RAD);
+            if (IsVisible(&queue, PASS_DEBUG, sphereMesh, world, frustum))
+            {
+                normal = NormalMatrix(world);
+                Submit(&queue, PASS_DEBUG, shaderNormals, sphereMesh, Distance(cameraPos, Translation(world)));
+                SendMat4(&queue, "u_world", world);
+                SendMat3(&queue, "u_normal", normal);
+            }
             
-            // Draws the Spot Light with sphere outline
+            // Draws the Point Light and Spot Light with sphere outlines, as one multi-draw from the mesh pool
             // Not sure why the spot light goes through the middle sphere
-            shaderProgram = shaderUniformColor;
-            glUseProgram(shaderProgram);
-            world = Scale(V3_ONE) * Translate(rotatedSpotLightPosition);
-            mvp = world * view * proj;
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            u_color = glGetUniformLocation(shaderProgram, "u_color");
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glUniform3fv(u_color, 1, &lightColor.x);
-            glPolygonMode(GL_FRONT_AND_BACK, GL_LINE);
-            DrawMesh(sphereMesh); // Draw spot light source
-            glPolygonMode(GL_FRONT_AND_BACK, GL_FILL);
+            Affine gizmoWorlds[] =
+            {
+                AffineScale(V3_ONE * lightRadius) * AffineTranslate(pointLightSpherePosition) * AffineRotateZ(60 * DEG2RAD),
+                AffineScale(V3_ONE) * AffineTranslate(rotatedSpotLightPosition)
+            };
+            for (Affine gizmoWorld : gizmoWorlds)
+            {
+                if (IsVisible(&queue, PASS_GIZMOS, sphereMesh, gizmoWorld, frustum))
+                {
+                    InstanceData gizmo = ToInstance(gizmoWorld, { lightColor.x, lightColor.y, lightColor.z, 1.0f });
+                    SubmitPooled(&queue, PASS_GIZMOS, shaderPooledColor, meshPool, spherePooled, gizmo, Distance(cameraPos, Translation(gizmoWorld)), { GL_LINE, true });
+                }
+            }
             
             // Draws a sphere that Refracts the skybox
-            shaderProgram = shaderRefract;
-            glUseProgram(shaderProgram);
-            world = Translate(refractionSpherePosition) * RotateZ(90 * DEG2RAD);
-            mvp = world * view * proj;
-            normal = Transpose(Invert(world));
-            u_normal = glGetUniformLocation(shaderProgram, "u_normal");
-            u_world = glGetUniformLocation(shaderProgram, "u_world");
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            u_cameraPositionPoint = glGetUniformLocation(shaderProgram, "u_cameraPositionPoint");
-            glUniformMatrix3fv(u_normal, 1, GL_FALSE, ToFloat9(normal).v);
-            glUniformMatrix4fv(u_world, 1, GL_FALSE, ToFloat16(world).v);
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glUniform3fv(u_cameraPositionPoint, 1, &cameraPos.x);
-            glUniform1f(glGetUniformLocation(shaderProgram, "u_ratio"), 1.00f / refractiveIndex);
-            DrawMesh(sphereMesh);
+            world = AffineTranslate(refractionSpherePosition) * AffineRotateZ(90 * DEG2RAD);
+            if (IsVisible(&queue, PASS_REFRACT, sphereMesh, world, frustum))
+            {
+                normal = NormalMatrix(world);
+                Submit(&queue, PASS_REFRACT, shaderRefract, sphereMesh, Distance(cameraPos, Translation(world)));
+                SetTexture(&queue, 0, GL_TEXTURE_CUBE_MAP, skyBoxTexture);
+                SendMat3(&queue, "u_normal", normal);
+                SendMat4(&queue, "u_world", world);
+                SendFloat(&queue, "u_ratio", 1.00f / refractiveIndex);
+            }
 
             // Draws a sphere that Reflects the skybox
-            shaderProgram = shaderReflect;
-            glUseProgram(shaderProgram);
-            reflectWorld = Scale(V3_ONE) * Translate(reflectionSpherePosition) * RotateZ(120 * DEG2RAD);
-            mvp = reflectWorld * view * proj;
-            normal = Transpose(Invert(reflectWorld));
-            u_cameraPositionPoint = glGetUniformLocation(shaderProgram, "u_cameraPositionPoint");
-            u_normal = glGetUniformLocation(shaderProgram, "u_normal");
-            u_world = glGetUniformLocation(shaderProgram, "u_world");
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            glUniformMatrix3fv(u_normal, 1, GL_FALSE, ToFloat9(normal).v);
-            glUniformMatrix4fv(u_world, 1, GL_FALSE, ToFloat16(reflectWorld).v);
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glUniform3fv(u_cameraPositionPoint, 1, &cameraPos.x);
-            DrawMesh(sphereMesh);
+            reflectWorld = AffineScale(V3_ONE) * AffineTranslate(reflectionSpherePosition) * AffineRotateZ(120 * DEG2RAD);
+            if (IsVisible(&queue, PASS_REFLECT, sphereMesh, reflectWorld, frustum))
+            {
+                normal = NormalMatrix(reflectWorld);
+                Submit(&queue, PASS_REFLECT, shaderReflect, sphereMesh, Distance(cameraPos, Translation(reflectWorld)));
+                SetTexture(&queue, 0, GL_TEXTURE_CUBE_MAP, skyBoxTexture);
+                SendMat3(&queue, "u_normal", normal);
+                SendMat4(&queue, "u_world", reflectWorld);
+            }
 
             break;
         }
         case 2:
+        {
             // Only for testing skybox, refraction, reflection
-            shaderProgram = shaderSkybox;
-            glUseProgram(shaderProgram);
-            Matrix viewSky = view;
-            viewSky.m12 = viewSky.m13 = viewSky.m14 = 0.0f;
-            mvp = world * viewSky * proj;
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glBindTexture(GL_TEXTURE_CUBE_MAP, skyBoxTexture);
-            glDepthMask(GL_FALSE);
-            DrawMesh(cubeMesh);
-            glDepthMask(GL_TRUE);
+            Submit(&queue, PASS_SKYBOX, shaderSkybox, cubeMesh, 0.0f, { GL_FILL, false });
+            SetTexture(&queue, 0, GL_TEXTURE_CUBE_MAP, skyBoxTexture);
 
             // Reflect cube
-            shaderProgram = shaderReflect;
-            glUseProgram(shaderProgram);
-            world = Translate(-1.0f, 0.0f, -2.0f);
-            mvp = world * viewSky * proj;
-            normal = Transpose(Invert(world));
-            u_cameraPositionPoint = glGetUniformLocation(shaderProgram, "u_cameraPositionPoint");
-            u_normal = glGetUniformLocation(shaderProgram, "u_normal");
-            u_world = glGetUniformLocation(shaderProgram, "u_world");
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            glUniformMatrix3fv(u_normal, 1, GL_FALSE, ToFloat9(normal).v);
-            glUniformMatrix4fv(u_world, 1, GL_FALSE, ToFloat16(world).v);
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glUniform3fv(u_cameraPositionPoint, 1, &cameraPos.x);
-            DrawMesh(cubeMesh);
+            world = AffineTranslate(-1.0f, 0.0f, -2.0f);
+            if (IsVisible(&queue, PASS_REFLECT, cubeMesh, world, frustum))
+            {
+                normal = NormalMatrix(world);
+                Submit(&queue, PASS_REFLECT, shaderReflect, cubeMesh, Distance(cameraPos, Translation(world)));
+                SetTexture(&queue, 0, GL_TEXTURE_CUBE_MAP, skyBoxTexture);
+                SendMat3(&queue, "u_normal", normal);
+                SendMat4(&queue, "u_world", world);
+            }
 
             // Refract cube
-            shaderProgram = shaderRefract;
-            glUseProgram(shaderProgram);
-            world = Translate(1.0f, 0.0f, -2.0f);
-            mvp = world * viewSky * proj;
-            normal = Transpose(Invert(world));
-            u_normal = glGetUniformLocation(shaderProgram, "u_normal");
-            u_world = glGetUniformLocation(shaderProgram, "u_world");
-            u_mvp = glGetUniformLocation(shaderProgram, "u_mvp");
-            u_cameraPositionPoint = glGetUniformLocation(shaderProgram, "u_cameraPositionPoint");
-            glUniformMatrix3fv(u_normal, 1, GL_FALSE, ToFloat9(normal).v);
-            glUniformMatrix4fv(u_world, 1, GL_FALSE, ToFloat16(world).v);
-            glUniformMatrix4fv(u_mvp, 1, GL_FALSE, ToFloat16(mvp).v);
-            glUniform3fv(u_cameraPositionPoint, 1, &cameraPos.x);
-            glUniform1f(glGetUniformLocation(shaderProgram, "u_ratio"), 1.00f / refractiveIndex);
-            DrawMesh(cubeMesh);
+            world = AffineTranslate(1.0f, 0.0f, -2.0f);
+            if (IsVisible(&queue, PASS_REFRACT, cubeMesh, world, frustum))
+            {
+                normal = NormalMatrix(world);
+                Submit(&queue, PASS_REFRACT, shaderRefract, cubeMesh, Distance(cameraPos, Translation(world)));
+                SetTexture(&queue, 0, GL_TEXTURE_CUBE_MAP, skyBoxTexture);
+                SendMat3(&queue, "u_normal", normal);
+                SendMat4(&queue, "u_world", world);
+                SendFloat(&queue, "u_ratio", 1.00f / refractiveIndex);
+            }
 
             break;
+        }
 
         case 3:
+        {
+            // A grid of bobbing spheres drawn as instances of one draw, so the draw count doesn't grow with the grid
+            sphereInstances.clear();
+            float sphereDepth = FLT_MAX;
+            for (int z = 0; z < SPHERE_GRID_SIZE; z++)
+            {
+                for (int x = 0; x < SPHERE_GRID_SIZE; x++)
+                {
+                    float u = x / (float)(SPHERE_GRID_SIZE - 1);
+                    float v = z / (float)(SPHERE_GRID_SIZE - 1);
+                    Vector3 position = { (u - 0.5f) * 8.0f, sinf(time * 2.0f + (u + v) * 6.0f) * 0.25f - 1.0f, (v - 0.5f) * 8.0f - 4.0f };
+                    Affine sphereWorld = AffineScale(V3_ONE * 0.2f) * AffineTranslate(position);
+                    if (!IsVisible(&queue, PASS_INSTANCED, sphereMesh, sphereWorld, frustum))
+                        continue;
+
+                    sphereInstances.push_back(ToInstance(sphereWorld, { u, v, 1.0f - u, 1.0f }));
+                    sphereDepth = fminf(sphereDepth, Distance(cameraPos, position));
+                }
+            }
+            if (!sphereInstances.empty())
+                SubmitInstanced(&queue, PASS_INSTANCED, shaderInstancedColor, sphereMesh, sphereInstances.data(), (int)sphereInstances.size(), sphereDepth);
             break;
+        }
 
         case 4:
             break;
@@ -635,43 +659,71 @@ int main(void)
         case 5:
             break;
         }
+        Flush(&queue, &profiler);
         
-        ImGui_ImplOpenGL3_NewFrame();
-        ImGui_ImplGlfw_NewFrame();
-        ImGui::NewFrame();
-        if (imguiDemo)
-            ImGui::ShowDemoWindow();
-        else
+        // UI is left out of headless runs so their frames only depend on the scene
+        if (!headless)
         {
-            ImGui::SliderFloat3("Camera Position", &cameraPos.x, -10.0f, 10.0f);
-            ImGui::SliderFloat3("Point Light Position", &lightPositionOrbit.x, -10.0f, 10.0f);
-            ImGui::SliderFloat("Point Light Radius", &lightRadius, 0.25f, 20.0f);
-            ImGui::SliderFloat3("Spot Light Position", &lightPositionSpot.x, -10.0f, 10.0f);
-            ImGui::SliderFloat("Spot Light Radius", &lightRadiusSpot, 0.25f, 20.0f);
-            ImGui::SliderFloat("Refraction Index", &refractiveIndex, 1.0f, 3.0f);
-
-            ImGui::RadioButton("Orthographic", (int*)&projection, 0); ImGui::SameLine();
-            ImGui::RadioButton("Perspective", (int*)&projection, 1);
-
-            ImGui::SliderFloat("Near", &near, -10.0f, 10.0f);
-            ImGui::SliderFloat("Far", &far, -10.0f, 10.0f);
-            if (projection == ORTHO)
-            {
-                ImGui::SliderFloat("Left", &left, -1.0f, -10.0f);
-                ImGui::SliderFloat("Right", &right, 1.0f, 10.0f);
-                ImGui::SliderFloat("Top", &top, 1.0f, 10.0f);
-                ImGui::SliderFloat("Bottom", &bottom, -1.0f, -10.0f);
-            }
-            else if (projection == PERSP)
+            BeginPass(&profiler, PASS_IMGUI);
+            ImGui_ImplOpenGL3_NewFrame();
+            ImGui_ImplGlfw_NewFrame();
+            ImGui::NewFrame();
+            if (showProfiler)
+                DrawProfiler(profiler);
+            if (imguiDemo)
+                ImGui::ShowDemoWindow();
+            else
             {
-                ImGui::SliderAngle("FoV", &fov, 10.0f, 90.0f);
+                ImGui::SliderFloat3("Camera Position", &cameraPos.x, -10.0f, 10.0f);
+                ImGui::SliderFloat3("Point Light Position", &lightPositionOrbit.x, -10.0f, 10.0f);
+                ImGui::SliderFloat("Point Light Radius", &lightRadius, 0.25f, 20.0f);
+                ImGui::SliderFloat3("Spot Light Position", &lightPositionSpot.x, -10.0f, 10.0f);
+                ImGui::SliderFloat("Spot Light Radius", &lightRadiusSpot, 0.25f, 20.0f);
+                ImGui::SliderFloat("Refraction Index", &refractiveIndex, 1.0f, 3.0f);
+                ImGui::Checkbox("Profiler", &showProfiler);
+
+                ImGui::RadioButton("Orthographic", (int*)&projection, 0); ImGui::SameLine();
+                ImGui::RadioButton("Perspective", (int*)&projection, 1);
+
+                ImGui::SliderFloat("Near", &near, -10.0f, 10.0f);
+                ImGui::SliderFloat("Far", &far, -10.0f, 10.0f);
+                if (projection == ORTHO)
+                {
+                    ImGui::SliderFloat("Left", &left, -1.0f, -10.0f);
+                    ImGui::SliderFloat("Right", &right, 1.0f, 10.0f);
+                    ImGui::SliderFloat("Top", &top, 1.0f, 10.0f);
+                    ImGui::SliderFloat("Bottom", &bottom, -1.0f, -10.0f);
+                }
+                else if (projection == PERSP)
+                {
+                    ImGui::SliderAngle("FoV", &fov, 10.0f, 90.0f);
+                }
             }
-        }
         
-        ImGui::Render();
-        ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+            ImGui::Render();
+            ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
+
+            // The backend sets GL state directly (restoring most of it after), so don't trust the shadowed values
+            InvalidateState();
+
+            // ImGui's backend doesn't go through our wrappers, so count its draws here
+            for (const ImDrawList* list : ImGui::GetDrawData()->CmdLists)
+                gRenderStats.drawCalls += list->CmdBuffer.Size;
+            EndPass(&profiler);
+        }
+        EndRingFrame(&ring);
+
+        if (headless)
+        {
+            // Wait for the GPU so frame times include rendering rather than just submission
+            glFinish();
+            frameTimes.push_back(std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - frameStart).count());
+            dt = HEADLESS_DT;
+            frameIndex++;
+            continue;
+        }
 
-        timeCurr = glfwGetTime();
+        timeCurr = GetTime();
         dt = timeCurr - timePrev;
 
         /* Swap front and back buffers */
@@ -682,10 +734,31 @@ int main(void)
         glfwPollEvents();
     }
 
-    ImGui_ImplOpenGL3_Shutdown();
-    ImGui_ImplGlfw_Shutdown();
-    ImGui::DestroyContext();
-    glfwTerminate();
+    if (headless)
+    {
+        PrintFrameStats(frameTimes);
+        printf("Last frame: %i draws, %i state changes (%i skipped), %i objects visible, %i culled\n",
+            gRenderStats.drawCalls, gRenderStats.stateChanges, gRenderStats.skippedStateChanges, gRenderStats.visibleObjects, gRenderStats.culledObjects);
+        if (pngPath != nullptr && SaveFramebuffer(headlessContext, pngPath))
+            printf("Saved final frame to %s\n", pngPath);
+    }
+
+    DestroyProfiler(&profiler);
+    DestroyAssetLoader(&loader);
+    DestroyMeshPool(&meshPool);
+    DestroyRingBuffer(&ring);
+
+    if (headless)
+    {
+        DestroyHeadlessContext(&headlessContext);
+    }
+    else
+    {
+        ImGui_ImplOpenGL3_Shutdown();
+        ImGui_ImplGlfw_Shutdown();
+        ImGui::DestroyContext();
+        glfwTerminate();
+    }
     return 0;
 }
 
@@ -710,85 +783,6 @@ void error_callback(int error, const char* description)
     printf("GLFW Error %d: %s\n", error, description);
 }
 
-// Compile a shader
-GLuint CreateShader(GLint type, const char* path)
-{
-    GLuint shader = GL_NONE;
-    try
-    {
-        // Load text file
-        std::ifstream file;
-        file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-        file.open(path);
-
-        // Interpret the file as a giant string
-        std::stringstream stream;
-        stream << file.rdbuf();
-        file.close();
-
-        // Verify shader type matches shader file extension
-        const char* ext = strrchr(path, '.');
-        switch (type)
-        {
-        case GL_VERTEX_SHADER:
-            assert(strcmp(ext, ".vert") == 0);
-            break;
-
-        case GL_FRAGMENT_SHADER:
-            assert(strcmp(ext, ".frag") == 0);
-            break;
-        default:
-            assert(false, "Invalid shader type");
-            break;
-        }
-
-        // Compile text as a shader
-        std::string str = stream.str();
-        const char* src = str.c_str();
-        shader = glCreateShader(type);
-        glShaderSource(shader, 1, &src, NULL);
-        glCompileShader(shader);
-
-        // Check for compilation errors
-        GLint success;
-        GLchar infoLog[512];
-        glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
-        if (!success)
-        {
-            glGetShaderInfoLog(shader, 512, NULL, infoLog);
-            std::cout << "Shader failed to compile: \n" << infoLog << std::endl;
-        }
-    }
-    catch (std::ifstream::failure& e)
-    {
-        std::cout << "Shader (" << path << ") not found: " << e.what() << std::endl;
-        assert(false);
-    }
-
-    return shader;
-}
-
-// Combine two compiled shaders into a program that can run on the GPU
-GLuint CreateProgram(GLuint vs, GLuint fs)
-{
-    GLuint program = glCreateProgram();
-    glAttachShader(program, vs);
-    glAttachShader(program, fs);
-    glLinkProgram(program);
-
-    // Check for linking errors
-    int success;
-    char infoLog[512];
-    glGetProgramiv(program, GL_LINK_STATUS, &success);
-    if (!success) {
-        program = GL_NONE;
-        glGetProgramInfoLog(program, 512, NULL, infoLog);
-        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
-    }
-
-    return program;
-}
-
 // Graphics debug callback
 void APIENTRY glDebugOutput(GLenum source, GLenum type, unsigned int id, GLenum severity, GLsizei length, const char* message, const void* userParam)
 {
@@ -846,6 +840,12 @@ bool IsKeyPressed(int key)
     return gKeysPrev[key] == GLFW_PRESS && gKeysCurr[key] == GLFW_RELEASE;
 }
 
+double GetTime()
+{
+    static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
 void Print(Matrix m)
 {
     printf("%f %f %f %f\n", m.m0, m.m4, m.m8, m.m12);
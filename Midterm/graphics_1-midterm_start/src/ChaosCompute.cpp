@@ -0,0 +1,67 @@
+#include "ChaosCompute.h"
+#include <algorithm>
+#include <cassert>
+
+typedef void (APIENTRYP PFNGLDISPATCHCOMPUTEPROC)(GLuint num_groups_x, GLuint num_groups_y, GLuint num_groups_z);
+typedef void (APIENTRYP PFNGLMEMORYBARRIERPROC)(GLbitfield barriers);
+
+static PFNGLDISPATCHCOMPUTEPROC gDispatchCompute = nullptr;
+static PFNGLMEMORYBARRIERPROC gMemoryBarrier = nullptr;
+
+// Must match local_size_x in Chaos.comp
+constexpr int CHAINS_PER_GROUP = 64;
+
+bool LoadComputeFunctions(GLADloadproc load)
+{
+	GLint major = 0, minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &major);
+	glGetIntegerv(GL_MINOR_VERSION, &minor);
+	if (major < 4 || (major == 4 && minor < 3))
+		return false;
+
+	gDispatchCompute = (PFNGLDISPATCHCOMPUTEPROC)load("glDispatchCompute");
+	gMemoryBarrier = (PFNGLMEMORYBARRIERPROC)load("glMemoryBarrier");
+	return gDispatchCompute != nullptr && gMemoryBarrier != nullptr;
+}
+
+void GenerateChaosPointsGPU(GLuint program, GLuint buffer, int count, const ChaosTriangle& triangle, uint32_t seed)
+{
+	assert(gDispatchCompute != nullptr);
+	const Vector3* p = triangle.corners;
+	Vector3 centroid = Centroid(triangle);
+	GLfloat corners[6] = { p[0].x, p[0].y, p[1].x, p[1].y, p[2].x, p[2].y };
+	GLuint colors[3] = { PackColor(triangle.colors[0]), PackColor(triangle.colors[1]), PackColor(triangle.colors[2]) };
+
+	glUseProgram(program);
+	glUniform2fv(glGetUniformLocation(program, "u_corners"), 3, corners);
+	glUniform1uiv(glGetUniformLocation(program, "u_colors"), 3, colors);
+	glUniform2f(glGetUniformLocation(program, "u_start"), centroid.x, centroid.y);
+	glUniform1ui(glGetUniformLocation(program, "u_seed"), seed);
+	GLint firstChainLocation = glGetUniformLocation(program, "u_firstChain");
+	GLint countLocation = glGetUniformLocation(program, "u_count");
+
+	// 10^8 points are bigger than most drivers let one storage block be, so the buffer is filled in batches.
+	// Batches are whole work groups, which keeps every range's offset aligned too.
+	GLint maxBlockSize = 0, alignment = 0;
+	glGetIntegerv(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &maxBlockSize);
+	glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+	const int groupPoints = CHAINS_PER_GROUP * CHAOS_POINTS_PER_CHAIN;
+	const int batchPoints = std::max(1, maxBlockSize / (int)sizeof(ChaosPoint) / groupPoints) * groupPoints;
+	assert((groupPoints * sizeof(ChaosPoint)) % alignment == 0);
+
+	for (int first = 0; first < count; first += batchPoints)
+	{
+		int points = std::min(batchPoints, count - first);
+		int chains = (points + CHAOS_POINTS_PER_CHAIN - 1) / CHAOS_POINTS_PER_CHAIN;
+		int groups = (chains + CHAINS_PER_GROUP - 1) / CHAINS_PER_GROUP;
+
+		glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 0, buffer, (GLintptr)first * sizeof(ChaosPoint), (GLsizeiptr)points * sizeof(ChaosPoint));
+		glUniform1ui(firstChainLocation, first / CHAOS_POINTS_PER_CHAIN);
+		glUniform1ui(countLocation, points);
+		gDispatchCompute(groups, 1, 1);
+	}
+	glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, GL_NONE);
+
+	// The points are read next as vertices (drawing) or through glGetBufferSubData (verifying)
+	gMemoryBarrier(GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <glad/glad.h>
+#include "ChaosGame.h"
+
+// Our glad loader only covers GL 3.3, so the few 4.3 names the compute path needs are defined here
+#ifndef GL_COMPUTE_SHADER
+#define GL_COMPUTE_SHADER 0x91B9
+#endif
+#ifndef GL_SHADER_STORAGE_BUFFER
+#define GL_SHADER_STORAGE_BUFFER 0x90D2
+#endif
+#ifndef GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT
+#define GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT 0x00000001
+#endif
+#ifndef GL_BUFFER_UPDATE_BARRIER_BIT
+#define GL_BUFFER_UPDATE_BARRIER_BIT 0x00000200
+#endif
+#ifndef GL_MAX_SHADER_STORAGE_BLOCK_SIZE
+#define GL_MAX_SHADER_STORAGE_BLOCK_SIZE 0x90DE
+#endif
+#ifndef GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT
+#define GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT 0x90DF
+#endif
+
+// Loads glDispatchCompute and glMemoryBarrier. Returns false if the context is older than 4.3.
+bool LoadComputeFunctions(GLADloadproc load);
+
+// Runs Chaos.comp (program) to fill buffer with count ChaosPoints, the same ones GenerateChaosPointsReference makes.
+// buffer must already hold count points. Nothing goes through the CPU, so it can be drawn as a vertex buffer right away.
+void GenerateChaosPointsGPU(GLuint program, GLuint buffer, int count, const ChaosTriangle& triangle, uint32_t seed);
@@ -0,0 +1,211 @@
+#include "ChaosGame.h"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define CHAOS_SSE2
+#include <emmintrin.h>
+#endif
+
+constexpr int LANES = 4;	// Chains run side by side by each thread
+
+// Steps taken before a chain's points are kept. Each step halves the distance to the attractor,
+// so after this many the starting point no longer shows at float precision.
+constexpr int WARMUP = 32;
+
+// Expands the seed into well-mixed, independent per-chain states
+static uint32_t SplitMix(uint64_t x)
+{
+	x += 0x9E3779B97F4A7C15ull;
+	x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+	x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+	x ^= x >> 31;
+	uint32_t state = (uint32_t)x;
+	return state != 0 ? state : 1;	// xorshift gets stuck on 0
+}
+
+Vector3 Centroid(const ChaosTriangle& triangle)
+{
+	const Vector3* p = triangle.corners;
+	return { (p[0].x + p[1].x + p[2].x) / 3.0f, (p[0].y + p[1].y + p[2].y) / 3.0f, (p[0].z + p[1].z + p[2].z) / 3.0f };
+}
+
+uint32_t PackColor(Vector3 color)
+{
+	uint32_t r = (uint32_t)floorf(color.x * 255.0f + 0.5f);
+	uint32_t g = (uint32_t)floorf(color.y * 255.0f + 0.5f);
+	uint32_t b = (uint32_t)floorf(color.z * 255.0f + 0.5f);
+	return r | (g << 8) | (b << 16) | (255u << 24);
+}
+
+// Both versions use the same integer RNG and the same float operations in the same order,
+// so SIMD and scalar builds generate identical points.
+#ifdef CHAOS_SSE2
+// a where neither mask is set, b where is1 is set, c where is2 is set
+static inline __m128 Select(__m128 a, __m128 b, __m128 c, __m128 is1, __m128 is2)
+{
+	__m128 ab = _mm_or_ps(_mm_and_ps(is1, b), _mm_andnot_ps(is1, a));
+	return _mm_or_ps(_mm_and_ps(is2, c), _mm_andnot_ps(is2, ab));
+}
+
+static void RunChains(Vertex* out, int count, const ChaosTriangle& triangle, const uint32_t seeds[LANES])
+{
+	const Vector3* p = triangle.corners;
+	const Vector3* c = triangle.colors;
+	Vector3 centroid = Centroid(triangle);
+	__m128 x = _mm_set1_ps(centroid.x);
+	__m128 y = _mm_set1_ps(centroid.y);
+	__m128 z = _mm_set1_ps(centroid.z);
+	__m128i state = _mm_loadu_si128((const __m128i*)seeds);
+	const __m128 half = _mm_set1_ps(0.5f);
+	const __m128i one = _mm_set1_epi32(1);
+	const __m128i two = _mm_set1_epi32(2);
+
+	alignas(16) float xs[LANES], ys[LANES], zs[LANES], rs[LANES], gs[LANES], bs[LANES];
+	for (int i = -WARMUP * LANES; i < count; i += LANES)
+	{
+		// xorshift32 in every lane
+		state = _mm_xor_si128(state, _mm_slli_epi32(state, 13));
+		state = _mm_xor_si128(state, _mm_srli_epi32(state, 17));
+		state = _mm_xor_si128(state, _mm_slli_epi32(state, 5));
+
+		// Corner = (top 16 bits * 3) >> 16, which is 0, 1 or 2
+		__m128i top = _mm_srli_epi32(state, 16);
+		__m128i corner = _mm_srli_epi32(_mm_add_epi32(top, _mm_slli_epi32(top, 1)), 16);
+		__m128 is1 = _mm_castsi128_ps(_mm_cmpeq_epi32(corner, one));
+		__m128 is2 = _mm_castsi128_ps(_mm_cmpeq_epi32(corner, two));
+
+		x = _mm_mul_ps(_mm_add_ps(x, Select(_mm_set1_ps(p[0].x), _mm_set1_ps(p[1].x), _mm_set1_ps(p[2].x), is1, is2)), half);
+		y = _mm_mul_ps(_mm_add_ps(y, Select(_mm_set1_ps(p[0].y), _mm_set1_ps(p[1].y), _mm_set1_ps(p[2].y), is1, is2)), half);
+		z = _mm_mul_ps(_mm_add_ps(z, Select(_mm_set1_ps(p[0].z), _mm_set1_ps(p[1].z), _mm_set1_ps(p[2].z), is1, is2)), half);
+		if (i < 0)
+			continue;
+
+		_mm_store_ps(xs, x);
+		_mm_store_ps(ys, y);
+		_mm_store_ps(zs, z);
+		_mm_store_ps(rs, Select(_mm_set1_ps(c[0].x), _mm_set1_ps(c[1].x), _mm_set1_ps(c[2].x), is1, is2));
+		_mm_store_ps(gs, Select(_mm_set1_ps(c[0].y), _mm_set1_ps(c[1].y), _mm_set1_ps(c[2].y), is1, is2));
+		_mm_store_ps(bs, Select(_mm_set1_ps(c[0].z), _mm_set1_ps(c[1].z), _mm_set1_ps(c[2].z), is1, is2));
+
+		// Lanes write neighbouring vertices so the output is written front to back
+		int lanes = std::min(LANES, count - i);
+		for (int lane = 0; lane < lanes; lane++)
+			out[i + lane] = { { xs[lane], ys[lane], zs[lane] }, { rs[lane], gs[lane], bs[lane] } };
+	}
+}
+#else
+static void RunChains(Vertex* out, int count, const ChaosTriangle& triangle, const uint32_t seeds[LANES])
+{
+	const Vector3* p = triangle.corners;
+	Vector3 centroid = Centroid(triangle);
+	Vector3 points[LANES];
+	uint32_t states[LANES];
+	for (int lane = 0; lane < LANES; lane++)
+	{
+		points[lane] = centroid;
+		states[lane] = seeds[lane];
+	}
+
+	for (int i = -WARMUP * LANES; i < count; i += LANES)
+	{
+		for (int lane = 0; lane < LANES; lane++)
+		{
+			uint32_t& state = states[lane];
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			int corner = (int)(((state >> 16) * 3) >> 16);
+
+			Vector3& point = points[lane];
+			point.x = (point.x + p[corner].x) * 0.5f;
+			point.y = (point.y + p[corner].y) * 0.5f;
+			point.z = (point.z + p[corner].z) * 0.5f;
+			if (i >= 0 && i + lane < count)
+				out[i + lane] = { point, triangle.colors[corner] };
+		}
+	}
+}
+#endif
+
+void GenerateChaosPoints(Vertex* out, int count, const ChaosTriangle& triangle, uint32_t seed, int threadCount)
+{
+	if (threadCount <= 0)
+		threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+	// Whole steps per thread, so only the last thread has a partial step
+	int chunk = (count + threadCount - 1) / threadCount;
+	chunk = (chunk + LANES - 1) / LANES * LANES;
+
+	auto work = [&](int thread)
+	{
+		int begin = thread * chunk;
+		int end = std::min(count, begin + chunk);
+		if (begin >= end)
+			return;
+
+		uint32_t seeds[LANES];
+		for (int lane = 0; lane < LANES; lane++)
+			seeds[lane] = SplitMix(((uint64_t)seed << 32) | (uint32_t)(thread * LANES + lane));
+		RunChains(out + begin, end - begin, triangle, seeds);
+	};
+
+	// The calling thread does the first chunk itself
+	std::vector<std::thread> threads;
+	threads.reserve(threadCount - 1);
+	for (int thread = 1; thread < threadCount; thread++)
+		threads.emplace_back(work, thread);
+	work(0);
+	for (std::thread& thread : threads)
+		thread.join();
+}
+
+// Same hash as Chaos.comp (lowbias32). Chains are seeded from their index, so any chain can be generated on its own.
+static uint32_t Hash(uint32_t x)
+{
+	x ^= x >> 16;
+	x *= 0x7FEB352Du;
+	x ^= x >> 15;
+	x *= 0x846CA68Bu;
+	x ^= x >> 16;
+	return x;
+}
+
+void GenerateChaosPointsReference(ChaosPoint* out, int count, const ChaosTriangle& triangle, uint32_t seed)
+{
+	const Vector3* p = triangle.corners;
+	Vector3 centroid = Centroid(triangle);
+	uint32_t colors[3] = { PackColor(triangle.colors[0]), PackColor(triangle.colors[1]), PackColor(triangle.colors[2]) };
+
+	int chains = (count + CHAOS_POINTS_PER_CHAIN - 1) / CHAOS_POINTS_PER_CHAIN;
+	for (int chain = 0; chain < chains; chain++)
+	{
+		uint32_t state = Hash(seed ^ Hash((uint32_t)chain));
+		if (state == 0)
+			state = 1;
+
+		float x = centroid.x;
+		float y = centroid.y;
+		int first = chain * CHAOS_POINTS_PER_CHAIN;
+		int last = std::min(count, first + CHAOS_POINTS_PER_CHAIN);
+		for (int i = first - WARMUP; i < last; i++)
+		{
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+			int corner = (int)(((state >> 16) * 3) >> 16);
+
+			x = (x + p[corner].x) * 0.5f;
+			y = (y + p[corner].y) * 0.5f;
+			if (i < first)
+				continue;
+
+			// Truncated to the snorm16 grid rather than rounded, so there's no multiply-add the GPU could fuse
+			out[i].x = (int16_t)floorf(x * 32767.0f);
+			out[i].y = (int16_t)floorf(y * 32767.0f);
+			out[i].color = colors[corner];
+		}
+	}
+}
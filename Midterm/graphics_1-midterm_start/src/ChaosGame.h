@@ -0,0 +1,44 @@
+#pragma once
+#include <cstdint>
+#include "Math.h"
+
+// Must match the attributes in Default.vert (0 = position, 1 = color)
+struct Vertex
+{
+	Vector3 position;
+	Vector3 color;
+};
+
+// Compact vertex for the GPU path (see Chaos.comp). Default.vert reads it unchanged:
+// x and y are normalized shorts (z = 0) and color is normalized rgba bytes.
+struct ChaosPoint
+{
+	int16_t x;
+	int16_t y;
+	uint32_t color;
+};
+static_assert(sizeof(ChaosPoint) == 8, "ChaosPoint must match Chaos.comp");
+
+// Points each chain of the GPU path generates. Must match POINTS_PER_CHAIN in Chaos.comp.
+constexpr int CHAOS_POINTS_PER_CHAIN = 256;
+
+// Triangle the points are generated in, each corner with its own color
+struct ChaosTriangle
+{
+	Vector3 corners[3];
+	Vector3 colors[3];
+};
+
+// Chaos game: every point is halfway between the previous point and a random corner, colored by that corner.
+// The output is split between threadCount threads (0 = one per core). Each runs its own independent chains
+// (4 at a time in SIMD lanes) from its own RNG stream, so the result only depends on seed, count and threadCount.
+// out only needs to be writable, so it can be a mapped vertex buffer. Nothing is read back from it.
+void GenerateChaosPoints(Vertex* out, int count, const ChaosTriangle& triangle, uint32_t seed, int threadCount = 0);
+
+// Generates exactly what Chaos.comp does, one chain at a time, to check the GPU's output against.
+// The GPU path is 2D, so the corners' z is ignored.
+void GenerateChaosPointsReference(ChaosPoint* out, int count, const ChaosTriangle& triangle, uint32_t seed);
+
+// Computed on the CPU for both paths, so they start from and write identical values
+uint32_t PackColor(Vector3 color);	// Normalized rgba bytes, alpha = 1
+Vector3 Centroid(const ChaosTriangle& triangle);
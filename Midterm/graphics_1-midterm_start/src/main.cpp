@@ -1,7 +1,13 @@
 #include <glad/glad.h>
 #include <GLFW/glfw3.h>
+#include "ChaosCompute.h"
+#include "ChaosGame.h"
 #include "Math.h"
 
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -41,6 +47,10 @@ GLuint CreateShader(GLint type, const char* path)
         case GL_FRAGMENT_SHADER:
             assert(strcmp(ext, ".frag") == 0);
             break;
+
+        case GL_COMPUTE_SHADER:
+            assert(strcmp(ext, ".comp") == 0);
+            break;
         default:
             assert(false, "Invalid shader type");
             break;
@@ -90,22 +100,61 @@ GLuint CreateProgram(GLuint vs, GLuint fs)
     return shaderProgram;
 }
 
-struct Vertex
+GLuint CreateProgram(GLuint cs)
 {
-    Vector3 position;
-    Vector3 color;
-};
+    GLuint shaderProgram = glCreateProgram();
+    glAttachShader(shaderProgram, cs);
+    glLinkProgram(shaderProgram);
 
-using Vertices = std::vector<Vertex>;
+    // Check for linking errors
+    int success;
+    char infoLog[512];
+    glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
+    if (!success) {
+        glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
+        shaderProgram = GL_NONE;
+        std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n" << infoLog << std::endl;
+    }
+
+    return shaderProgram;
+}
 
-int main()
+int main(int argc, char** argv)
 {
+    // --points N sets how many chaos-game points to generate (default 2 million)
+    // --gpu generates them with a compute shader instead (needs GL 4.3), meant for counts like 10^8
+    // --verify checks the compute shader's points against the CPU reference
+    int pointCount = 2000000;
+    bool gpu = false;
+    bool verify = false;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--points") == 0 && i + 1 < argc)
+            pointCount = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--gpu") == 0)
+            gpu = true;
+        else if (strcmp(argv[i], "--verify") == 0)
+            verify = true;
+    }
+    if (pointCount <= 0)
+    {
+        printf("--points must be a positive number of points\n");
+        return -1;
+    }
+
     glfwInit();
-    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, gpu ? 4 : 3);
     glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
     glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
 
     GLFWwindow* window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
+    if (window == NULL && gpu)
+    {
+        printf("No GL 4.3 context, generating points on the CPU instead\n");
+        gpu = false;
+        glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+        window = glfwCreateWindow(SCR_WIDTH, SCR_HEIGHT, "LearnOpenGL", NULL, NULL);
+    }
     if (window == NULL)
     {
         std::cout << "Failed to create GLFW window" << std::endl;
@@ -121,6 +170,12 @@ int main()
         return -1;
     }
 
+    if (gpu && !LoadComputeFunctions((GLADloadproc)glfwGetProcAddress))
+    {
+        printf("Compute shaders not supported, generating points on the CPU instead\n");
+        gpu = false;
+    }
+
     GLuint vsDefault = CreateShader(GL_VERTEX_SHADER, "./assets/shaders/Default.vert");
     GLuint fsDefault = CreateShader(GL_FRAGMENT_SHADER, "./assets/shaders/Default.frag");
     GLuint shaderDefault = CreateProgram(vsDefault, fsDefault);
@@ -138,35 +193,80 @@ int main()
         { 0.0f, 0.0f, 1.0f }
     };
 
-    // Task 1 -- loop through all vertices to assign positions and colors
-    const int loopVerts = 30000;
-    Vertices vertices(loopVerts);
+    ChaosTriangle triangle;
+    for (int i = 0; i < 3; i++)
+    {
+        triangle.corners[i] = positions[i];
+        triangle.colors[i] = colors[i];
+    }
 
-    Vertex vertex[loopVerts];
-    Vector3 prevPos[loopVerts];
-    Vector3 currentPos[loopVerts];
-    Vector3 nextPos;
-    Vector3 currentColour[3];
+    // Task 1 & 2 -- generate the points on every core straight into the vertex buffer,
+    // or with a compute shader that writes the vertex buffer itself
+    GLuint vao, vbo;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    glGenBuffers(1, &vbo);
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    if (gpu)
+    {
+        // 8 bytes a point, so 10^8 points fit in 800MB
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)pointCount * sizeof(ChaosPoint), nullptr, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 2, GL_SHORT, GL_TRUE, sizeof(ChaosPoint), (void*)offsetof(ChaosPoint, x));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(ChaosPoint), (void*)offsetof(ChaosPoint, color));
+        glEnableVertexAttribArray(1);
 
-    //currentPos[0] = (positions[0] + positions[1]) * 0.5f;
-    //currentPos[1] = (currentPos[0] + positions[0]) * 0.5f;
-    for (int i = 0; i < loopVerts; i++)
+        GLuint csChaos = CreateShader(GL_COMPUTE_SHADER, "./assets/shaders/Chaos.comp");
+        GLuint shaderChaos = CreateProgram(csChaos);
+        GenerateChaosPointsGPU(shaderChaos, vbo, pointCount, triangle, 1234);
+        glFinish();
+        glDeleteProgram(shaderChaos);
+        glDeleteShader(csChaos);
+        glUseProgram(shaderDefault);
+    }
+    else
     {
-        // Find midpoint so - next vertex = (current vertex + previous vertex) * 0.5 
-        // Need to make currentPos and prevPos have a value
-        vertex[i].position = (currentPos[i] + prevPos[i]) * 0.5f;
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)pointCount * sizeof(Vertex), nullptr, GL_STATIC_DRAW);
+        glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, position));
+        glEnableVertexAttribArray(0);
+        glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+        glEnableVertexAttribArray(1);
 
-        //int k = (int)(rand() % 3);
-        //int next = (i + 1) % 2;
-        //
-        //nextPos[i] = (currentPos[i] + currentPos[next]) * 0.5f;
-        //currentColour[i] = colors[k];
-        //currentPos[next] = nextPos[i];
-        
+        Vertex* vertices = (Vertex*)glMapBufferRange(GL_ARRAY_BUFFER, 0, (GLsizeiptr)pointCount * sizeof(Vertex), GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        // Fails when the driver can't allocate the buffer (10^8 points are 2.4GB here, see --gpu)
+        if (vertices == nullptr)
+        {
+            printf("Failed to map a vertex buffer for %i points (GL error 0x%x)\n", pointCount, glGetError());
+            glfwTerminate();
+            return -1;
+        }
+        GenerateChaosPoints(vertices, pointCount, triangle, 1234);
+        glUnmapBuffer(GL_ARRAY_BUFFER);
     }
+    double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    printf("Generated %i points on the %s in %.2fms (%.1f million points/s)\n", pointCount, gpu ? "GPU" : "CPU", ms, pointCount / (ms * 1000.0));
 
-    // Task 2 -- upload vertices to the GPU
-    GLuint vao, vbo;
+    // Checks a prefix so verifying 10^8 points doesn't take a minute. Chains are independent, so a prefix is still exact.
+    if (verify && gpu)
+    {
+        int count = std::min(pointCount, 1 << 22);
+        std::vector<ChaosPoint> expected(count), actual(count);
+        GenerateChaosPointsReference(expected.data(), count, triangle, 1234);
+        glGetBufferSubData(GL_ARRAY_BUFFER, 0, count * sizeof(ChaosPoint), actual.data());
+
+        int mismatches = 0;
+        for (int i = 0; i < count; i++)
+        {
+            if (memcmp(&expected[i], &actual[i], sizeof(ChaosPoint)) != 0)
+                mismatches++;
+        }
+        printf("Verified %i points against the CPU reference: %i mismatches\n", count, mismatches);
+    }
+    else if (verify)
+    {
+        printf("--verify only checks the GPU path, add --gpu\n");
+    }
 
     while (!glfwWindowShouldClose(window))
     {
@@ -174,13 +274,14 @@ int main()
 
         glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
         glClear(GL_COLOR_BUFFER_BIT);
-        glBufferSubData(GL_ARRAY_BUFFER, 0, 3 * sizeof(Vector3), currentPos);
-        glDrawArrays(GL_POINTS, 0, vertices.size());
+        glDrawArrays(GL_POINTS, 0, pointCount);
 
         glfwSwapBuffers(window);
         glfwPollEvents();
     }
 
+    glDeleteBuffers(1, &vbo);
+    glDeleteVertexArrays(1, &vao);
     glfwTerminate();
     return 0;
 }